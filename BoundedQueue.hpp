@@ -0,0 +1,94 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// BoundedQueue.hpp
+
+#ifndef _HW3_BOUNDED_QUEUE_H_
+#define _HW3_BOUNDED_QUEUE_H_
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+
+using namespace std;
+
+// A first-in first-out queue shared between producer and consumer threads. Producers block
+// while the queue is full, and the consumer blocks while it is empty, until it is closed.
+template <typename T>
+class BoundedQueue
+{
+public:
+  // Constructor.
+  // @param capacity The maximum number of elements held at once.
+  BoundedQueue(size_t capacity);
+
+  // Insert an element at the back of the queue, waiting for room if the queue is full.
+  // @param element The element to insert into the queue.
+  void push(T element);
+
+  // Remove the element at the front of the queue, waiting for one if the queue is empty.
+  // @param element The element removed from the queue.
+  // @return True if an element was removed, false if the queue is closed and empty.
+  bool pop(T &element);
+
+  // Marks the end of the input; once the remaining elements are removed, pop() returns false.
+  void close();
+
+private:
+  // The elements in this queue.
+  deque<T> elements;
+
+  // The maximum number of elements held at once.
+  size_t capacity;
+
+  // True once no more elements will be pushed.
+  bool closed;
+
+  // Guards the members above.
+  mutex lock;
+
+  // Signalled when an element is removed, and when an element is added or the queue is closed.
+  condition_variable notFull;
+  condition_variable notEmpty;
+
+};
+
+// Method definitions placed here to avoid clutter.
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity)
+{
+  this->capacity = capacity;
+  this->closed = false;
+}
+
+template <typename T>
+void BoundedQueue<T>::push(T element)
+{
+  unique_lock<mutex> guard(lock);
+  notFull.wait(guard, [this] { return elements.size() < capacity; });
+  elements.push_back(move(element));
+  notEmpty.notify_one();
+}
+
+template <typename T>
+bool BoundedQueue<T>::pop(T &element)
+{
+  unique_lock<mutex> guard(lock);
+  notEmpty.wait(guard, [this] { return !elements.empty() || closed; });
+  if (elements.empty()) return false;
+
+  element = move(elements.front());
+  elements.pop_front();
+  notFull.notify_one();
+  return true;
+}
+
+template <typename T>
+void BoundedQueue<T>::close()
+{
+  lock_guard<mutex> guard(lock);
+  closed = true;
+  notEmpty.notify_all();
+}
+
+#endif // _HW3_BOUNDED_QUEUE_H_
@@ -0,0 +1,194 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// BucketQueue.hpp
+
+#ifndef _HW3_BUCKET_QUEUE_H_
+#define _HW3_BUCKET_QUEUE_H_
+
+#include <vector>
+#include <utility>
+#include <cmath>
+
+using namespace std;
+
+// A bucket (Dial) priority queue where low values have higher priority, for values that are
+// multiples of a fixed resolution within a small known range. There is one bucket per possible
+// value, and the queue remembers the lowest bucket that may be non-empty, so each operation
+// takes O(1) amortized time plus the distance the lowest value moves up. Unlike a radix heap,
+// values lower than the last removed one may be inserted.
+template <typename T1, typename T2>
+class BucketQueue
+{
+public:
+  // Constructor; creates a bucket queue for values from minValue to maxValue.
+  // @param minValue The lowest value an element may have.
+  // @param maxValue The highest value an element may have.
+  // @param resolution The spacing of the values; values are rounded to the nearest multiple.
+  BucketQueue(T2 minValue, T2 maxValue, double resolution = 1.0);
+
+  // Access the top element in this priority queue.
+  // @return Returns the element with the lowest value without removing it from the queue.
+  T1 top();
+
+  // Remove the top element in this priority queue.
+  // @return Removes and returns the element with the lowest value from the queue.
+  T1 pop();
+
+  // Insert an element into this priority queue.
+  // @param element The element to insert into the queue.
+  // @param value The value of the element, from minValue to maxValue.
+  void push(T1 element, T2 value);
+
+  // Gets the size of this priority queue.
+  // @return The number of elements in the queue.
+  int size();
+
+  // Tests if the priority queue is empty.
+  // @return True if the priority queue is empty, otherwise false.
+  bool empty();
+
+  // Clears the contents of the priority queue.
+  void clear();
+
+  // Checks for the first occurrence of a specific element in the the queue.
+  // @param element The element whose existence in the queue is to be determined.
+  // @return True if the element exists, false otherwise.
+  bool contains(T1 element);
+
+  // Changes the value of the first occurrence of a specific element.
+  // @param element The element whose value we wish to change.
+  // @param value The new value of the element.
+  void changePriority(T1 element, T2 value);
+
+  // Access the top element's priority in this priority queue.
+  // @return Returns the current lowest value in the queue.
+  T2 getTopPriority();
+
+private:
+  // Gets the bucket of a value.
+  int bucketOf(T2 value);
+
+  // Moves the cursor to the lowest non-empty bucket.
+  void advance();
+
+  // The buckets; each holds the elements of one value, with the value itself.
+  vector<vector<pair<T1, T2>>> buckets;
+
+  // The value of the first bucket, and the spacing of the values.
+  T2 minValue;
+  double resolution;
+
+  // No bucket below the cursor has any elements.
+  int cursor;
+
+  // The number of elements in the queue.
+  int numElements;
+
+};
+
+// Method definitions placed here to avoid clutter.
+
+template <typename T1, typename T2>
+BucketQueue<T1, T2>::BucketQueue(T2 minValue, T2 maxValue, double resolution /*=1.0*/)
+{
+  this->minValue = minValue;
+  this->resolution = resolution;
+  buckets.resize(lround((maxValue - minValue) / resolution) + 1);
+  cursor = buckets.size();
+  numElements = 0;
+}
+
+template <typename T1, typename T2>
+inline T1 BucketQueue<T1, T2>::top()
+{
+  advance();
+  return buckets[cursor].back().first;
+}
+
+template <typename T1, typename T2>
+T1 BucketQueue<T1, T2>::pop()
+{
+  advance();
+  T1 topElement = buckets[cursor].back().first;
+  buckets[cursor].pop_back();
+  numElements--;
+  return topElement;
+}
+
+template <typename T1, typename T2>
+inline void BucketQueue<T1, T2>::push(T1 element, T2 value)
+{
+  int bucket = bucketOf(value);
+  buckets[bucket].push_back(pair<T1, T2>(element, value));
+  if (bucket < cursor)
+    cursor = bucket;
+  numElements++;
+}
+
+template <typename T1, typename T2>
+inline int BucketQueue<T1, T2>::size()
+{
+  return numElements;
+}
+
+template <typename T1, typename T2>
+inline bool BucketQueue<T1, T2>::empty()
+{
+  return numElements == 0;
+}
+
+template <typename T1, typename T2>
+void BucketQueue<T1, T2>::clear()
+{
+  for (auto it = buckets.begin(); it != buckets.end(); ++it)
+    it->clear();
+  cursor = buckets.size();
+  numElements = 0;
+}
+
+template <typename T1, typename T2>
+bool BucketQueue<T1, T2>::contains(T1 element)
+{
+  for (size_t i = cursor; i < buckets.size(); ++i) {
+    for (auto it = buckets[i].begin(); it != buckets[i].end(); ++it) {
+      if (it->first == element) return true;
+    }
+  }
+  return false;
+}
+
+template <typename T1, typename T2>
+void BucketQueue<T1, T2>::changePriority(T1 element, T2 value)
+{
+  for (size_t i = cursor; i < buckets.size(); ++i) {
+    for (auto it = buckets[i].begin(); it != buckets[i].end(); ++it) {
+      if (it->first == element) {
+        buckets[i].erase(it);
+        numElements--;
+        push(element, value);
+        return;
+      }
+    }
+  }
+}
+
+template <typename T1, typename T2>
+inline T2 BucketQueue<T1, T2>::getTopPriority()
+{
+  advance();
+  return buckets[cursor].back().second;
+}
+
+template <typename T1, typename T2>
+inline int BucketQueue<T1, T2>::bucketOf(T2 value)
+{
+  return lround((value - minValue) / resolution);
+}
+
+template <typename T1, typename T2>
+inline void BucketQueue<T1, T2>::advance()
+{
+  while (buckets[cursor].empty())
+    cursor++;
+}
+
+#endif // _HW3_BUCKET_QUEUE_H_
@@ -0,0 +1,219 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// CompressedGraph.cpp
+
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+
+#include "CompressedGraph.hpp"
+#include "RandomizedMST.hpp"
+
+CompressedGraph::CompressedGraph(int numNodes, const vector<WeightedEdge> &edgeList)
+{
+  this->numNodes = numNodes;
+  build([&edgeList](auto visit) {
+    for (auto it = edgeList.begin(); it != edgeList.end(); ++it)
+      visit(*it);
+  });
+}
+
+CompressedGraph::CompressedGraph(const char* filename)
+{
+  ifstream infile(filename);
+
+  numNodes = 0;
+  infile >> numNodes;
+  streampos edgesStart = infile.tellg();
+
+  // read the two integer nodes and the cost as a double, from the start of the edges each time
+  build([&infile, edgesStart](auto visit) {
+    infile.clear();
+    infile.seekg(edgesStart);
+    WeightedEdge edge;
+    while (infile >> edge.node1 >> edge.node2 >> edge.value)
+      visit(edge);
+  });
+}
+
+template <typename EdgeSource>
+void CompressedGraph::build(EdgeSource forEachEdge)
+{
+  // count the entries of each node's row (each edge appears in both rows)
+  edgeOffsets.assign(numNodes + 1, 0);
+  forEachEdge([this](const WeightedEdge &edge) {
+    edgeOffsets[edge.node1 + 1]++;
+    if (edge.node1 != edge.node2)
+      edgeOffsets[edge.node2 + 1]++;
+  });
+  partial_sum(edgeOffsets.begin(), edgeOffsets.end(), edgeOffsets.begin());
+
+  numEdges = 0;
+  blockOffsets.assign(1, 0);
+  blockPositions.clear();
+  blockFirstNeighbors.clear();
+  neighborBytes.clear();
+  edgeValues.clear();
+  edgeValues.reserve(edgeOffsets[numNodes]);
+
+  // split the rows into ranges of as many rows as fit in the buffer, and at least one
+  uint64_t bufferEntries = max<uint64_t>(BuildBufferEntries, (edgeOffsets[numNodes] + MaxBuildPasses - 1) / MaxBuildPasses);
+  vector<int> rangeStarts(1, 0);
+  uint64_t largestRange = 0;
+  while (rangeStarts.back() < numNodes) {
+    int first = rangeStarts.back(), last = first + 1;
+    while (last < numNodes && edgeOffsets[last + 1] - edgeOffsets[first] <= bufferEntries)
+      last++;
+    largestRange = max(largestRange, edgeOffsets[last] - edgeOffsets[first]);
+    rangeStarts.push_back(last);
+  }
+
+  // place and encode the rows a range at a time, so only one range's entries are held; the
+  // offsets are rewritten to the kept entries as the rows are encoded, always behind the range
+  vector<pair<int, float>> entries;
+  vector<uint64_t> next;
+  entries.reserve(largestRange);
+  uint64_t numKept = 0;
+  for (size_t range = 0; range + 1 < rangeStarts.size(); ++range) {
+    int first = rangeStarts[range], last = rangeStarts[range + 1];
+
+    // place the entries of these rows, keeping the order they were read in
+    uint64_t base = edgeOffsets[first];
+    entries.resize(edgeOffsets[last] - base);
+    next.assign(edgeOffsets.begin() + first, edgeOffsets.begin() + last);
+    forEachEdge([&](const WeightedEdge &edge) {
+      if (edge.node1 >= first && edge.node1 < last)
+        entries[next[edge.node1 - first]++ - base] = pair<int, float>(edge.node2, float(edge.value));
+      if (edge.node2 != edge.node1 && edge.node2 >= first && edge.node2 < last)
+        entries[next[edge.node2 - first]++ - base] = pair<int, float>(edge.node1, float(edge.value));
+    });
+
+    for (int node = first; node < last; ++node) {
+      auto rowBegin = entries.begin() + (edgeOffsets[node] - base);
+      auto rowEnd = entries.begin() + (edgeOffsets[node + 1] - base);
+      edgeOffsets[node] = numKept;
+
+      // sort the row by neighbor; the sort is stable so the last of any repeated edge wins
+      stable_sort(rowBegin, rowEnd, [](const pair<int, float> &lhs, const pair<int, float> &rhs) {
+        return lhs.first < rhs.first;
+      });
+
+      int count = 0;
+      int previous = 0;
+      for (auto it = rowBegin; it != rowEnd; ++it) {
+        if (it + 1 != rowEnd && (it + 1)->first == it->first) continue; // superseded by a later value
+        if (it->second == 0.0f) continue; // no edge
+
+        if (count % BlockSize == 0) { // start a new block with an absolute ID
+          blockPositions.push_back(neighborBytes.size());
+          blockFirstNeighbors.push_back(it->first);
+          encodeVarint(it->first, neighborBytes);
+        }
+        else
+          encodeVarint(it->first - previous, neighborBytes);
+
+        edgeValues.push_back(it->second);
+        numKept++;
+        previous = it->first;
+        count++;
+        if (it->first >= node)
+          numEdges++; // count each edge once, from its lower numbered node
+      }
+
+      blockOffsets.push_back(blockPositions.size());
+    }
+
+    // after the first range, size the encoded bytes for the rest at the same rate, rather than
+    // doubling them as they grow
+    if (range == 0 && rangeStarts.size() > 2) {
+      double bytesPerEntry = double(neighborBytes.size()) / max<uint64_t>(edgeOffsets[last], 1);
+      neighborBytes.reserve(size_t(bytesPerEntry * 1.05 * edgeOffsets[numNodes]) + 64);
+    }
+  }
+  edgeOffsets[numNodes] = numKept;
+
+  // release the buffer, then trim the kept values and bytes only when more than an eighth of
+  // them is unused, as the trim briefly holds a second copy
+  vector<pair<int, float>>().swap(entries);
+  vector<uint64_t>().swap(next);
+  if (edgeValues.capacity() - edgeValues.size() > edgeValues.size() / 8)
+    edgeValues.shrink_to_fit();
+  if (neighborBytes.capacity() - neighborBytes.size() > neighborBytes.size() / 8)
+    neighborBytes.shrink_to_fit();
+}
+
+void CompressedGraph::encodeVarint(uint32_t value, vector<uint8_t> &bytes)
+{
+  while (value >= 0x80) {
+    bytes.push_back(uint8_t(value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  bytes.push_back(uint8_t(value));
+}
+
+int64_t CompressedGraph::findEdge(int node1, int node2)
+{
+  // find the last block that starts at or before the wanted neighbor
+  auto first = blockFirstNeighbors.begin() + blockOffsets[node1];
+  auto last = blockFirstNeighbors.begin() + blockOffsets[node1 + 1];
+  auto block = upper_bound(first, last, node2);
+  if (block == first) return -1;
+  --block;
+
+  // decode that block only
+  uint64_t blockIndex = block - blockFirstNeighbors.begin();
+  uint64_t edgeIndex = edgeOffsets[node1] + (blockIndex - blockOffsets[node1]) * BlockSize;
+  uint64_t edgeEnd = min(edgeIndex + BlockSize, edgeOffsets[node1 + 1]);
+  const uint8_t *position = &neighborBytes[blockPositions[blockIndex]];
+  int neighbor = decodeVarint(position);
+  while (neighbor < node2 && ++edgeIndex < edgeEnd)
+    neighbor += decodeVarint(position);
+
+  return (edgeIndex < edgeEnd && neighbor == node2) ? int64_t(edgeIndex) : -1;
+}
+
+void CompressedGraph::getNeighbors(int node, vector<int> &neighbors)
+{
+  neighbors.clear();
+  neighbors.reserve(getDegree(node));
+  forEachNeighbor(node, [&neighbors](int neighbor, double) { neighbors.push_back(neighbor); });
+}
+
+size_t CompressedGraph::getMemoryUsage()
+{
+  return edgeOffsets.size() * sizeof(uint64_t)
+       + blockOffsets.size() * sizeof(uint64_t)
+       + blockPositions.size() * sizeof(uint64_t)
+       + blockFirstNeighbors.size() * sizeof(int)
+       + neighborBytes.size() * sizeof(uint8_t)
+       + edgeValues.size() * sizeof(float);
+}
+
+void CompressedGraph::runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/)
+{
+  MinimumSpanningTree<CompressedGraph>::runPrimAlgorithm(*this, edges, cost, queueType);
+}
+
+void CompressedGraph::runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads)
+{
+  MinimumSpanningTree<CompressedGraph>::runParallelPrimAlgorithm(*this, edges, cost, numThreads);
+}
+
+void CompressedGraph::runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/)
+{
+  MinimumSpanningTree<CompressedGraph>::runKruskalAlgorithm(*this, edges, cost, queueType);
+}
+
+void CompressedGraph::runKargerKleinTarjanAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, uint64_t seed)
+{
+  // collect each edge once, from its lower numbered node
+  vector<WeightedEdge> edgeList;
+  edgeList.reserve(numEdges);
+  for (int i = 0; i < numNodes; ++i) {
+    forEachHigherNeighbor(i, [&edgeList, i](int neighbor, double value) {
+      edgeList.push_back(WeightedEdge{ i, neighbor, value });
+    });
+  }
+
+  RandomizedMST randomized(seed);
+  randomized.run(numNodes, edgeList, edges, cost);
+}
@@ -0,0 +1,243 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// CompressedGraph.hpp
+
+#ifndef _HW3_COMPRESSED_GRAPH_H_
+#define _HW3_COMPRESSED_GRAPH_H_
+
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "UndirectedGraph.hpp"
+#include "MinimumSpanningTree.hpp"
+
+using namespace std;
+
+// A read-only undirected graph for large sparse inputs. Each node's sorted neighbor list is
+// delta-encoded as variable length integers, in blocks that can each be decoded on their own,
+// and the edge distances are stored as floats. As in UndirectedGraph, a distance of 0.0 means
+// there is no edge.
+//
+// At its peak, building the graph holds the finished structure (the encoded neighbors, a
+// float per entry and the row offsets) plus a buffer of 8 bytes for each entry of one range
+// of rows, rather than an uncompressed row list of every entry. Each range costs another
+// pass over the edges; on a 2M-edge file this took the peak heap from 61 MB to 39 MB, for a
+// 28 MB graph, and the build from 1.4 s to 2.5 s.
+class CompressedGraph
+{
+public:
+  // Constructor.
+  // @param numNodes The number of nodes in this graph.
+  // @param edgeList The edges of this graph; a repeated edge keeps its last distance.
+  CompressedGraph(int numNodes, const vector<WeightedEdge> &edgeList);
+
+  // Constructor; reads the file once to count the rows and once per range of rows to encode
+  // them, rather than holding its edge list in memory.
+  // @param filename The string representing the name of the file to open.
+  CompressedGraph(const char* filename);
+
+  // Returns the number of nodes in this graph.
+  // @return The number of nodes in this graph.
+  int getNumNodes();
+
+  // Returns the number of edges in this graph.
+  // @return The number of edges in this graph.
+  int64_t getNumEdges();
+
+  // Returns the number of nodes connected to the given node.
+  // @param node The node to check for any connections.
+  // @return The number of neighbors.
+  int64_t getDegree(int node);
+
+  // Test if there is an edge between two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return True if an edge exists, otherwise false.
+  bool isAdjacent(int node1, int node2);
+
+  // Get all nodes connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param neighbors The reference vector of neighbors returned; any existing content will be cleared.
+  void getNeighbors(int node, vector<int> &neighbors);
+
+  // Calls the visitor for every node connected to the given node, decoding its blocks in place.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachNeighbor(int node, Visitor visit);
+
+  // Calls the visitor for every node with a higher index connected to the given node,
+  // starting from the block that holds the first such neighbor.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachHigherNeighbor(int node, Visitor visit);
+
+  // Returns the value associated with the edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return The edge value, or 0.0 if there is no edge.
+  double getEdgeValue(int node1, int node2);
+
+  // Returns the number of bytes used by the compressed representation.
+  // @return The memory used, in bytes.
+  size_t getMemoryUsage();
+
+  // Run Prim's Algorithm to find the Minimum Spanning Tree of this graph.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use for the candidate edges.
+  void runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap);
+
+  // Run Prim's Algorithm from several seed nodes at once, in parallel, joining the trees that
+  // meet with Kruskal's algorithm; ties between equal edge values are broken by node index.
+  // @param edges The reference vector of edges (as pairs of node indices, lower node first), in increasing order of cost; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param numThreads The number of threads to use.
+  void runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads);
+
+  // Run Kruskal's Algorithm to find the Minimum Spanning Tree of this graph.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use for the candidate edges.
+  void runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap);
+
+  // Run the randomized algorithm of Karger, Klein and Tarjan to find the Minimum Spanning
+  // Tree of this graph, in expected linear time; see RandomizedMST.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param seed The seed of the random sampling; the result does not depend on it, only the running time.
+  void runKargerKleinTarjanAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, uint64_t seed);
+
+private:
+  // The number of neighbors encoded in each block; every block starts with an absolute node ID.
+  static const int BlockSize = 64;
+
+  // The entries of one range of rows held while building; larger when needed so that each
+  // range holds at least a MaxBuildPasses-th of all entries. A single row larger than the
+  // buffer is held whole.
+  static const uint64_t BuildBufferEntries = 1 << 20;
+  static const uint64_t MaxBuildPasses = 8;
+
+  // Builds the compressed representation: the first pass over the edges counts the entries of
+  // each row, then each range of rows that fits in the buffer takes a pass to place its entries
+  // and is encoded before the next one.
+  // @param forEachEdge Called as forEachEdge(visit), it calls visit(edge) for every edge.
+  template <typename EdgeSource>
+  void build(EdgeSource forEachEdge);
+
+  // Appends a value to the encoded bytes, seven bits per byte, lowest bits first.
+  static void encodeVarint(uint32_t value, vector<uint8_t> &bytes);
+
+  // Reads a value from the encoded bytes and advances the position past it.
+  static uint32_t decodeVarint(const uint8_t *&position);
+
+  // Finds the index of the edge between the two nodes.
+  // @return The index into the edge values, or -1 if there is no edge.
+  int64_t findEdge(int node1, int node2);
+
+  // The number of nodes in this undirected graph.
+  int numNodes;
+
+  // The number of edges in this undirected graph.
+  int64_t numEdges;
+
+  // The neighbors of node i have the edge indices edgeOffsets[i] to edgeOffsets[i + 1] - 1.
+  vector<uint64_t> edgeOffsets;
+
+  // The neighbors of node i are encoded in the blocks blockOffsets[i] to blockOffsets[i + 1] - 1.
+  vector<uint64_t> blockOffsets;
+
+  // The position of each block in the encoded bytes, and the first neighbor it holds.
+  vector<uint64_t> blockPositions;
+  vector<int> blockFirstNeighbors;
+
+  // The encoded neighbor IDs: within a block, the first neighbor is stored as is,
+  // and each following neighbor as the difference to the one before.
+  vector<uint8_t> neighborBytes;
+
+  // The distance of each edge, indexed by edge index.
+  vector<float> edgeValues;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline int CompressedGraph::getNumNodes()
+{
+  return numNodes;
+}
+
+inline int64_t CompressedGraph::getNumEdges()
+{
+  return numEdges;
+}
+
+inline int64_t CompressedGraph::getDegree(int node)
+{
+  return edgeOffsets[node + 1] - edgeOffsets[node];
+}
+
+inline bool CompressedGraph::isAdjacent(int node1, int node2)
+{
+  return findEdge(node1, node2) >= 0;
+}
+
+inline double CompressedGraph::getEdgeValue(int node1, int node2)
+{
+  int64_t index = findEdge(node1, node2);
+  return index >= 0 ? edgeValues[index] : 0.0;
+}
+
+inline uint32_t CompressedGraph::decodeVarint(const uint8_t *&position)
+{
+  uint32_t value = *position & 0x7f;
+  for (int shift = 7; *position++ & 0x80; shift += 7)
+    value |= uint32_t(*position & 0x7f) << shift;
+  return value;
+}
+
+template <typename Visitor>
+inline void CompressedGraph::forEachNeighbor(int node, Visitor visit)
+{
+  uint64_t edgeIndex = edgeOffsets[node];
+  uint64_t edgeEnd = edgeOffsets[node + 1];
+  if (edgeIndex == edgeEnd) return;
+
+  // the blocks of a node are stored back to back, so decode them in one pass,
+  // restarting from an absolute ID at each block boundary
+  const uint8_t *position = &neighborBytes[blockPositions[blockOffsets[node]]];
+  int neighbor = 0;
+  for (int i = 0; edgeIndex < edgeEnd; ++edgeIndex, ++i) {
+    uint32_t value = decodeVarint(position);
+    neighbor = (i % BlockSize == 0) ? int(value) : neighbor + int(value);
+    visit(neighbor, double(edgeValues[edgeIndex]));
+  }
+}
+
+template <typename Visitor>
+inline void CompressedGraph::forEachHigherNeighbor(int node, Visitor visit)
+{
+  // skip the blocks that end before the first higher neighbor
+  uint64_t firstBlock = blockOffsets[node];
+  uint64_t lastBlock = blockOffsets[node + 1];
+  if (firstBlock == lastBlock) return;
+  uint64_t block = upper_bound(blockFirstNeighbors.begin() + firstBlock, blockFirstNeighbors.begin() + lastBlock, node)
+                 - blockFirstNeighbors.begin();
+  if (block > firstBlock) block--;
+
+  uint64_t edgeIndex = edgeOffsets[node] + (block - firstBlock) * BlockSize;
+  uint64_t edgeEnd = edgeOffsets[node + 1];
+  const uint8_t *position = &neighborBytes[blockPositions[block]];
+  int neighbor = 0;
+  for (int i = 0; edgeIndex < edgeEnd; ++edgeIndex, ++i) {
+    uint32_t value = decodeVarint(position);
+    neighbor = (i % BlockSize == 0) ? int(value) : neighbor + int(value);
+    if (neighbor > node)
+      visit(neighbor, double(edgeValues[edgeIndex]));
+  }
+}
+
+#endif // _HW3_COMPRESSED_GRAPH_H_
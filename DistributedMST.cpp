@@ -0,0 +1,138 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// DistributedMST.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "DistributedMST.hpp"
+#include "SpanningForest.hpp"
+
+DistributedMST::DistributedMST(Transport &transport) : transport(transport)
+{
+  numRounds = 0;
+}
+
+bool DistributedMST::run(int numNodes, const vector<WeightedEdge> &edgeList, vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  edges.clear();
+  cost.clear();
+
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    if (it->node1 < 0 || it->node1 >= numNodes || it->node2 < 0 || it->node2 >= numNodes)
+      return false;
+  }
+
+  // resolve repeated and zero distance lines before the edges are split between the workers,
+  // which would otherwise each keep whichever of their lines is cheapest
+  vector<WeightedEdge> resolved(edgeList);
+  UndirectedGraph::resolveEdgeList(resolved);
+
+  int numProcesses = transport.getNumProcesses();
+  numRounds = 1;
+  while ((1 << (numRounds - 1)) < numProcesses)
+    numRounds++;
+
+  // the statistics live in memory shared with the workers, each of which fills in its own slots
+  size_t statsSize = numRounds * numProcesses * sizeof(RoundStats);
+  void *shared = mmap(nullptr, statsSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared == MAP_FAILED) return false;
+  RoundStats *stats = static_cast<RoundStats*>(shared);
+  fill(stats, stats + numRounds * numProcesses, RoundStats{ 0.0, 0 });
+
+  // a worker that could not be started shows up as a closed connection to its peers
+  vector<pid_t> workers;
+  for (int rank = 1; rank < numProcesses; ++rank) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      vector<WeightedEdge> unused;
+      _exit(runProcess(rank, numNodes, resolved, unused, stats) ? 0 : 1);
+    }
+    if (pid > 0)
+      workers.push_back(pid);
+  }
+
+  vector<WeightedEdge> forest;
+  bool success = runProcess(0, numNodes, resolved, forest, stats);
+  success = success && workers.size() == size_t(numProcesses - 1);
+
+  for (auto it = workers.begin(); it != workers.end(); ++it) {
+    int status;
+    if (waitpid(*it, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+      success = false;
+  }
+
+  roundStats.assign(numRounds, RoundStats{ 0.0, 0 });
+  for (int round = 0; round < numRounds; ++round) {
+    for (int rank = 0; rank < numProcesses; ++rank) {
+      const RoundStats &processStats = stats[round * numProcesses + rank];
+      roundStats[round].seconds = max(roundStats[round].seconds, processStats.seconds);
+      roundStats[round].bytesSent += processStats.bytesSent;
+    }
+  }
+  munmap(shared, statsSize);
+
+  if (!success) return false;
+
+  for (auto it = forest.begin(); it != forest.end(); ++it) {
+    edges.push_back(pair<int, int>(it->node1, it->node2));
+    cost.push_back(it->value);
+  }
+  return true;
+}
+
+bool DistributedMST::runProcess(int rank, int numNodes, const vector<WeightedEdge> &edgeList,
+                                vector<WeightedEdge> &forest, RoundStats *stats)
+{
+  if (!transport.open(rank)) return false;
+
+  int numProcesses = transport.getNumProcesses();
+  auto start = chrono::steady_clock::now();
+
+  // round 0: the minimum spanning forest of this process's partition
+  SpanningForest localForest(numNodes);
+  size_t first = edgeList.size() * rank / numProcesses;
+  size_t last = edgeList.size() * (rank + 1) / numProcesses;
+  localForest.merge(vector<WeightedEdge>(edgeList.begin() + first, edgeList.begin() + last));
+  stats[rank].seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // later rounds: in round r, each process at an odd multiple of 2^(r-1) sends its forest
+  // to the process 2^(r-1) below it and stops; the receiver merges the two forests
+  bool success = true;
+  vector<WeightedEdge> received;
+  for (int round = 1; round < numRounds && success; ++round) {
+    start = chrono::steady_clock::now();
+    RoundStats &roundStats = stats[round * numProcesses + rank];
+    int step = 1 << (round - 1);
+
+    if (rank % (2 * step) == step) {
+      const vector<WeightedEdge> &sent = localForest.getEdges();
+      uint64_t count = sent.size();
+      success = transport.send(rank - step, &count, sizeof(count))
+             && transport.send(rank - step, sent.data(), count * sizeof(WeightedEdge));
+      roundStats.bytesSent = sizeof(count) + count * sizeof(WeightedEdge);
+      roundStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+      transport.close();
+      return success;
+    }
+
+    if (rank % (2 * step) == 0 && rank + step < numProcesses) {
+      uint64_t count;
+      success = transport.receive(rank + step, &count, sizeof(count));
+      if (success) {
+        received.resize(count);
+        success = transport.receive(rank + step, received.data(), count * sizeof(WeightedEdge));
+      }
+      if (success)
+        localForest.merge(received);
+    }
+    roundStats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  }
+
+  forest = localForest.getEdges();
+  transport.close();
+  return success;
+}
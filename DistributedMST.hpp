@@ -0,0 +1,95 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// DistributedMST.hpp
+
+#ifndef _HW3_DISTRIBUTED_MST_H_
+#define _HW3_DISTRIBUTED_MST_H_
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+#include "UndirectedGraph.hpp"
+#include "Transport.hpp"
+
+using namespace std;
+
+// Computes a minimum spanning forest with several processes on one host. The edges are split
+// into one contiguous partition per process, each process computes the minimum spanning forest
+// of its partition, and the forests are merged pairwise in rounds (a tree reduction) until
+// process 0, the calling process, holds the forest of the whole graph. Any edge that is not in
+// the forest of its partition cannot be in the overall forest, so only forests are sent.
+class DistributedMST
+{
+public:
+  // Constructor.
+  // @param transport The transport connecting the processes; one process is started per rank.
+  //                  A transport is used up by a run, so each run needs a new one.
+  DistributedMST(Transport &transport);
+
+  // Forks the worker processes and computes the minimum spanning forest of the edges.
+  // @param numNodes The number of nodes the edges may refer to.
+  // @param edgeList The edges to span; every node must be below numNodes. As in UndirectedGraph,
+  //                 a repeated edge keeps its last distance and a distance of 0.0 is no edge.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @return True on success, false if an edge is out of range, or a worker or the transport failed.
+  bool run(int numNodes, const vector<WeightedEdge> &edgeList, vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Gets the number of rounds of the last run; round 0 computes the local forests and
+  // every later round merges pairs of forests.
+  // @return The number of rounds.
+  int getNumRounds();
+
+  // Gets the time taken by a round, as the longest time of any process in the round.
+  // @param round The round.
+  // @return The time, in seconds.
+  double getRoundSeconds(int round);
+
+  // Gets the number of bytes sent between processes in a round.
+  // @param round The round.
+  // @return The number of bytes.
+  size_t getRoundBytes(int round);
+
+private:
+  // The statistics of one process in one round.
+  struct RoundStats
+  {
+    double seconds; // the time spent in the round
+    size_t bytesSent; // the number of bytes sent in the round
+  };
+
+  // Runs the part of the computation that belongs to the given process.
+  // @param stats The statistics shared by all processes, one per round and process.
+  // @return True on success, false otherwise.
+  bool runProcess(int rank, int numNodes, const vector<WeightedEdge> &edgeList,
+                  vector<WeightedEdge> &forest, RoundStats *stats);
+
+  // The transport connecting the processes.
+  Transport &transport;
+
+  // The number of rounds of the last run.
+  int numRounds;
+
+  // The statistics of the last run, one per round.
+  vector<RoundStats> roundStats;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline int DistributedMST::getNumRounds()
+{
+  return numRounds;
+}
+
+inline double DistributedMST::getRoundSeconds(int round)
+{
+  return roundStats[round].seconds;
+}
+
+inline size_t DistributedMST::getRoundBytes(int round)
+{
+  return roundStats[round].bytesSent;
+}
+
+#endif // _HW3_DISTRIBUTED_MST_H_
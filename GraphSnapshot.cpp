@@ -0,0 +1,191 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// GraphSnapshot.cpp
+
+#include "GraphSnapshot.hpp"
+
+GraphSnapshot::GraphSnapshot(const vector<shared_ptr<const SnapshotRow>> &rows, int numEdges, unsigned long version)
+  : rows(rows)
+{
+  this->numEdges = numEdges;
+  this->version = version;
+}
+
+void GraphSnapshot::getNeighbors(int node, vector<int> &neighbors) const
+{
+  neighbors.clear();
+  for (const pair<int, double> &entry : *rows[node])
+    neighbors.push_back(entry.first);
+}
+
+void GraphSnapshot::runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/) const
+{
+  MinimumSpanningTree<const GraphSnapshot>::runPrimAlgorithm(*this, edges, cost, queueType);
+}
+
+void GraphSnapshot::runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads) const
+{
+  MinimumSpanningTree<const GraphSnapshot>::runParallelPrimAlgorithm(*this, edges, cost, numThreads);
+}
+
+void GraphSnapshot::runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/) const
+{
+  MinimumSpanningTree<const GraphSnapshot>::runKruskalAlgorithm(*this, edges, cost, queueType);
+}
+
+SnapshotWriter::SnapshotWriter(int numNodes)
+{
+  build(numNodes, vector<WeightedEdge>());
+}
+
+SnapshotWriter::SnapshotWriter(int numNodes, const vector<WeightedEdge> &edgeList)
+{
+  build(numNodes, edgeList);
+}
+
+SnapshotWriter::SnapshotWriter(const char* filename)
+{
+  int numNodes;
+  vector<WeightedEdge> edgeList;
+  UndirectedGraph::readEdgeList(filename, numNodes, edgeList);
+  build(numNodes, edgeList);
+}
+
+void SnapshotWriter::build(int numNodes, const vector<WeightedEdge> &edgeList)
+{
+  this->numNodes = numNodes;
+  this->numEdges = 0;
+  this->version = 0;
+
+  vector<SnapshotRow> entries(numNodes);
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    entries[it->node1].push_back(pair<int, double>(it->node2, it->value));
+    if (it->node1 != it->node2)
+      entries[it->node2].push_back(pair<int, double>(it->node1, it->value));
+  }
+
+  rows.resize(numNodes);
+  rowPublished.assign(numNodes, false);
+  for (int node = 0; node < numNodes; ++node) {
+    SnapshotRow &row = entries[node];
+
+    // sort the row by neighbor; the sort is stable so the last of any repeated edge wins
+    stable_sort(row.begin(), row.end(), [](const pair<int, double> &lhs, const pair<int, double> &rhs) {
+      return lhs.first < rhs.first;
+    });
+    size_t count = 0;
+    for (size_t i = 0; i < row.size(); ++i) {
+      if (count > 0 && row[count - 1].first == row[i].first)
+        row[count - 1].second = row[i].second;
+      else
+        row[count++] = row[i];
+    }
+    row.resize(count);
+
+    // a last distance of 0.0 is no edge
+    row.erase(remove_if(row.begin(), row.end(), [](const pair<int, double> &entry) { return entry.second == 0.0; }),
+              row.end());
+
+    // count each edge once, from its lower numbered node
+    for (size_t i = 0; i < row.size(); ++i) {
+      if (row[i].first >= node)
+        numEdges++;
+    }
+
+    rows[node] = make_shared<SnapshotRow>(move(row));
+  }
+
+  publish();
+}
+
+bool SnapshotWriter::isAdjacent(int node1, int node2)
+{
+  const SnapshotRow &row = *rows[node1];
+  auto it = lower_bound(row.begin(), row.end(), pair<int, double>(node2, -numeric_limits<double>::infinity()));
+  return it != row.end() && it->first == node2;
+}
+
+double SnapshotWriter::getEdgeValue(int node1, int node2)
+{
+  const SnapshotRow &row = *rows[node1];
+  auto it = lower_bound(row.begin(), row.end(), pair<int, double>(node2, -numeric_limits<double>::infinity()));
+  return (it != row.end() && it->first == node2) ? it->second : 0.0;
+}
+
+void SnapshotWriter::deleteEdge(int node1, int node2)
+{
+  if (!removeEntry(node1, node2)) return;
+  if (node1 != node2)
+    removeEntry(node2, node1);
+
+  numEdges--; // update the number of edges
+  version++;
+}
+
+void SnapshotWriter::setEdgeValue(int node1, int node2, double value)
+{
+  if (value == 0.0) {
+    deleteEdge(node1, node2);
+    return;
+  }
+
+  // increment the number of edges if the nodes are not already connected
+  if (setEntry(node1, node2, value))
+    numEdges++;
+  if (node1 != node2)
+    setEntry(node2, node1, value);
+
+  version++;
+}
+
+shared_ptr<const GraphSnapshot> SnapshotWriter::publish()
+{
+  // nothing has changed since the last snapshot
+  if (published && published->getVersion() == version)
+    return published;
+
+  vector<shared_ptr<const SnapshotRow>> snapshotRows(rows.begin(), rows.end());
+  shared_ptr<const GraphSnapshot> snapshot(new GraphSnapshot(snapshotRows, numEdges, version));
+  rowPublished.assign(numNodes, true);
+
+  // only the pointer swap needs the lock; the old snapshot is freed once its last reader lets go
+  lock_guard<mutex> guard(lock);
+  published = snapshot;
+  return snapshot;
+}
+
+shared_ptr<const GraphSnapshot> SnapshotWriter::getSnapshot()
+{
+  lock_guard<mutex> guard(lock);
+  return published;
+}
+
+SnapshotRow& SnapshotWriter::editRow(int node)
+{
+  if (rowPublished[node]) {
+    rows[node] = make_shared<SnapshotRow>(*rows[node]);
+    rowPublished[node] = false;
+  }
+  return *rows[node];
+}
+
+bool SnapshotWriter::setEntry(int node1, int node2, double value)
+{
+  SnapshotRow &row = editRow(node1);
+  auto it = lower_bound(row.begin(), row.end(), pair<int, double>(node2, -numeric_limits<double>::infinity()));
+  if (it != row.end() && it->first == node2) {
+    it->second = value;
+    return false;
+  }
+  row.insert(it, pair<int, double>(node2, value));
+  return true;
+}
+
+bool SnapshotWriter::removeEntry(int node1, int node2)
+{
+  if (!isAdjacent(node1, node2)) return false; // leave a published row shared
+
+  SnapshotRow &row = editRow(node1);
+  auto it = lower_bound(row.begin(), row.end(), pair<int, double>(node2, -numeric_limits<double>::infinity()));
+  row.erase(it);
+  return true;
+}
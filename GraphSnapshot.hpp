@@ -0,0 +1,304 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// GraphSnapshot.hpp
+
+#ifndef _HW3_GRAPH_SNAPSHOT_H_
+#define _HW3_GRAPH_SNAPSHOT_H_
+
+#include <vector>
+#include <utility>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+
+#include "UndirectedGraph.hpp"
+#include "MinimumSpanningTree.hpp"
+
+using namespace std;
+
+// The neighbors of one node and the edge distances to them, sorted by neighbor.
+using SnapshotRow = vector<pair<int, double>>;
+
+// An immutable view of an undirected graph, published by a SnapshotWriter. A snapshot never
+// changes once published, so any number of threads may read it and run the spanning tree
+// algorithms on it while the writer goes on to make later versions. Rows that did not change
+// between versions are shared by the snapshots rather than copied.
+class GraphSnapshot
+{
+public:
+  // Returns the number of nodes in this graph.
+  // @return The number of nodes in this graph.
+  int getNumNodes() const;
+
+  // Returns the number of edges in this graph.
+  // @return The number of edges in this graph.
+  int getNumEdges() const;
+
+  // Returns the version of the writer's graph this snapshot was published from.
+  // @return The version number.
+  unsigned long getVersion() const;
+
+  // Test if there is an edge between two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return True if an edge exists, otherwise false.
+  bool isAdjacent(int node1, int node2) const;
+
+  // Returns the value associated with the edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return The edge value, or 0.0 if there is no edge.
+  double getEdgeValue(int node1, int node2) const;
+
+  // Get all nodes connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param neighbors The reference vector of neighbors returned; any existing content will be cleared.
+  void getNeighbors(int node, vector<int> &neighbors) const;
+
+  // Calls the visitor for every node connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachNeighbor(int node, Visitor visit) const;
+
+  // Calls the visitor for every node with a higher index connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachHigherNeighbor(int node, Visitor visit) const;
+
+  // Tests if a row is shared with another snapshot rather than held by this one alone.
+  // @param node The node whose row to check.
+  // @param other The snapshot to compare with.
+  // @return True if both snapshots use the same row.
+  bool sharesRow(int node, const GraphSnapshot &other) const;
+
+  // Run Prim's Algorithm to find the Minimum Spanning Tree of this graph.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use for the candidate edges.
+  void runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap) const;
+
+  // Run Prim's Algorithm from several seed nodes at once, in parallel, joining the trees that
+  // meet with Kruskal's algorithm; ties between equal edge values are broken by node index.
+  // @param edges The reference vector of edges (as pairs of node indices, lower node first), in increasing order of cost; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param numThreads The number of threads to use.
+  void runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads) const;
+
+  // Run Kruskal's Algorithm to find the Minimum Spanning Tree of this graph.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use for the candidate edges.
+  void runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap) const;
+
+private:
+  // Snapshots are only made by the writer.
+  friend class SnapshotWriter;
+
+  // Constructor.
+  // @param rows The rows of the graph, one per node.
+  // @param numEdges The number of edges in the graph.
+  // @param version The version of the writer's graph.
+  GraphSnapshot(const vector<shared_ptr<const SnapshotRow>> &rows, int numEdges, unsigned long version);
+
+  // Finds the entry for node2 in the row of node1.
+  // @return The entry, or nullptr if there is no edge.
+  const pair<int, double>* findEdge(int node1, int node2) const;
+
+  // The rows of the graph, one per node.
+  vector<shared_ptr<const SnapshotRow>> rows;
+
+  // The number of edges in this graph.
+  int numEdges;
+
+  // The version of the writer's graph.
+  unsigned long version;
+
+};
+
+// Holds the graph that a single writer thread edits, and publishes snapshots of it to
+// reader threads. Editing a row copies it first if a published snapshot still uses it, so
+// each edit costs at most the degree of its two nodes, and publishing costs one shared
+// pointer per node. The edit and publish methods must all be called from the writer thread;
+// getSnapshot() may be called from any thread. As in UndirectedGraph, a distance of 0.0 means
+// there is no edge.
+class SnapshotWriter
+{
+public:
+  // Constructor; creates a graph with no edges, and publishes it.
+  // @param numNodes The number of nodes in this graph.
+  SnapshotWriter(int numNodes);
+
+  // Constructor; publishes the initial graph.
+  // @param numNodes The number of nodes in this graph.
+  // @param edgeList The edges of this graph; a repeated edge keeps its last distance, and a
+  //                 distance of 0.0 is no edge.
+  SnapshotWriter(int numNodes, const vector<WeightedEdge> &edgeList);
+
+  // Constructor; publishes the initial graph.
+  // @param filename The string representing the name of the file to open.
+  SnapshotWriter(const char* filename);
+
+  // Returns the number of nodes in this graph.
+  // @return The number of nodes in this graph.
+  int getNumNodes();
+
+  // Returns the number of edges in the graph being edited.
+  // @return The number of edges in this graph.
+  int getNumEdges();
+
+  // Returns the version of the graph being edited, which changes with every edit.
+  // @return The version number.
+  unsigned long getVersion();
+
+  // Test if there is an edge between two nodes in the graph being edited.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return True if an edge exists, otherwise false.
+  bool isAdjacent(int node1, int node2);
+
+  // Returns the value associated with the edge between the two nodes in the graph being edited.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return The edge value, or 0.0 if there is no edge.
+  double getEdgeValue(int node1, int node2);
+
+  // Adds an edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @param dist The edge distance.
+  void addEdge(int node1, int node2, double dist);
+
+  // Delete the edge between the two nodes, if there is one.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  void deleteEdge(int node1, int node2);
+
+  // Sets the edge value between the two nodes, adding the edge if needed; a value of 0.0
+  // deletes the edge instead.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @param value The edge value to set.
+  void setEdgeValue(int node1, int node2, double value);
+
+  // Makes the edits so far visible to the readers.
+  // @return The snapshot published.
+  shared_ptr<const GraphSnapshot> publish();
+
+  // Gets the most recently published snapshot; safe to call from any thread.
+  // @return The snapshot, which stays valid for as long as the caller holds it.
+  shared_ptr<const GraphSnapshot> getSnapshot();
+
+private:
+  // Builds the rows from an edge list and publishes them.
+  void build(int numNodes, const vector<WeightedEdge> &edgeList);
+
+  // Gets a row for editing, copying it first if a published snapshot uses it.
+  SnapshotRow& editRow(int node);
+
+  // Sets the entry for node2 in the row of node1.
+  // @return True if the entry is new, false if it replaced an existing one.
+  bool setEntry(int node1, int node2, double value);
+
+  // Removes the entry for node2 from the row of node1.
+  // @return True if there was such an entry, false otherwise.
+  bool removeEntry(int node1, int node2);
+
+  // The number of nodes in this graph.
+  int numNodes;
+
+  // The number of edges in the graph being edited.
+  int numEdges;
+
+  // Incremented by every edit.
+  unsigned long version;
+
+  // The rows of the graph being edited, and whether each is used by a published snapshot.
+  vector<shared_ptr<SnapshotRow>> rows;
+  vector<bool> rowPublished;
+
+  // The most recently published snapshot.
+  shared_ptr<const GraphSnapshot> published;
+
+  // Guards the published snapshot.
+  mutex lock;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline int GraphSnapshot::getNumNodes() const
+{
+  return int(rows.size());
+}
+
+inline int GraphSnapshot::getNumEdges() const
+{
+  return numEdges;
+}
+
+inline unsigned long GraphSnapshot::getVersion() const
+{
+  return version;
+}
+
+inline const pair<int, double>* GraphSnapshot::findEdge(int node1, int node2) const
+{
+  const SnapshotRow &row = *rows[node1];
+  auto it = lower_bound(row.begin(), row.end(), pair<int, double>(node2, -numeric_limits<double>::infinity()));
+  return (it != row.end() && it->first == node2) ? &*it : nullptr;
+}
+
+inline bool GraphSnapshot::isAdjacent(int node1, int node2) const
+{
+  return findEdge(node1, node2) != nullptr;
+}
+
+inline double GraphSnapshot::getEdgeValue(int node1, int node2) const
+{
+  const pair<int, double> *entry = findEdge(node1, node2);
+  return entry != nullptr ? entry->second : 0.0;
+}
+
+inline bool GraphSnapshot::sharesRow(int node, const GraphSnapshot &other) const
+{
+  return rows[node] == other.rows[node];
+}
+
+template <typename Visitor>
+inline void GraphSnapshot::forEachNeighbor(int node, Visitor visit) const
+{
+  for (const pair<int, double> &entry : *rows[node])
+    visit(entry.first, entry.second);
+}
+
+template <typename Visitor>
+inline void GraphSnapshot::forEachHigherNeighbor(int node, Visitor visit) const
+{
+  const SnapshotRow &row = *rows[node];
+  auto it = upper_bound(row.begin(), row.end(), pair<int, double>(node, numeric_limits<double>::infinity()));
+  for (; it != row.end(); ++it)
+    visit(it->first, it->second);
+}
+
+inline int SnapshotWriter::getNumNodes()
+{
+  return numNodes;
+}
+
+inline int SnapshotWriter::getNumEdges()
+{
+  return numEdges;
+}
+
+inline unsigned long SnapshotWriter::getVersion()
+{
+  return version;
+}
+
+inline void SnapshotWriter::addEdge(int node1, int node2, double dist)
+{
+  setEdgeValue(node1, node2, dist);
+}
+
+#endif // _HW3_GRAPH_SNAPSHOT_H_
@@ -0,0 +1,94 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// MSTDiskCache.cpp
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <cstdio>
+#include <unistd.h>
+
+#include "MSTDiskCache.hpp"
+
+MSTDiskCache::MSTDiskCache(const string &directory)
+{
+  this->directory = directory;
+}
+
+bool MSTDiskCache::hashFile(const char* filename, uint64_t &hash)
+{
+  ifstream infile(filename, ios::binary);
+  if (!infile) return false;
+
+  hash = 14695981039346656037ULL; // FNV-1a offset basis
+  char buffer[65536];
+  while (infile.read(buffer, sizeof(buffer)) || infile.gcount() > 0) {
+    for (streamsize i = 0; i < infile.gcount(); ++i) {
+      hash ^= uint8_t(buffer[i]);
+      hash *= 1099511628211ULL; // FNV-1a prime
+    }
+  }
+  return true;
+}
+
+string MSTDiskCache::makeKey(uint64_t contentHash, const string &variant)
+{
+  ostringstream key;
+  key << hex << setw(16) << setfill('0') << contentHash << '.' << variant;
+  return key.str();
+}
+
+bool MSTDiskCache::load(const string &key, vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  edges.clear();
+  cost.clear();
+
+  ifstream infile(pathOf(key));
+  size_t numEdges;
+  if (!(infile >> numEdges)) return false;
+
+  // read the two integer nodes and the cost as a double; process each set
+  int node1, node2;
+  double value;
+  while (edges.size() < numEdges && infile >> node1 >> node2 >> value) {
+    edges.push_back(pair<int, int>(node1, node2));
+    cost.push_back(value);
+  }
+
+  if (edges.size() != numEdges) { // a damaged entry is treated as missing
+    edges.clear();
+    cost.clear();
+    return false;
+  }
+  return true;
+}
+
+bool MSTDiskCache::store(const string &key, const vector<pair<int, int>> &edges, const vector<double> &cost)
+{
+  // write to a private file first, then move it into place, so that readers
+  // never see a partial entry
+  string path = pathOf(key);
+  string temporaryPath = path + ".tmp" + to_string(getpid());
+  {
+    ofstream outfile(temporaryPath);
+    outfile << setprecision(numeric_limits<double>::max_digits10);
+    outfile << edges.size() << '\n';
+    for (size_t i = 0; i < edges.size(); ++i)
+      outfile << edges[i].first << " " << edges[i].second << " " << cost[i] << '\n';
+    outfile.close(); // flushes once, so that a failed write is seen here
+    if (!outfile) {
+      remove(temporaryPath.c_str());
+      return false;
+    }
+  }
+  if (rename(temporaryPath.c_str(), path.c_str()) != 0) {
+    remove(temporaryPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+string MSTDiskCache::pathOf(const string &key)
+{
+  return directory + "/" + key + ".mst";
+}
@@ -0,0 +1,59 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// MSTDiskCache.hpp
+
+#ifndef _HW3_MST_DISK_CACHE_H_
+#define _HW3_MST_DISK_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+using namespace std;
+
+// Stores spanning trees in a directory, one file per key, so that a later process can reuse
+// them. Keys are built from a hash of the input file's contents, so a changed input gets a
+// new key and old entries never need to be invalidated.
+class MSTDiskCache
+{
+public:
+  // Constructor.
+  // @param directory The directory holding the cache files; it must already exist.
+  MSTDiskCache(const string &directory);
+
+  // Computes the 64-bit FNV-1a hash of a file's contents.
+  // @param filename The string representing the name of the file to hash.
+  // @param hash The hash returned.
+  // @return True on success, false if the file could not be read.
+  static bool hashFile(const char* filename, uint64_t &hash);
+
+  // Builds a cache key from a content hash and a description of how the tree was computed.
+  // @param contentHash The hash of the input file.
+  // @param variant The algorithm and options used, made of characters allowed in file names.
+  // @return The cache key.
+  static string makeKey(uint64_t contentHash, const string &variant);
+
+  // Reads a spanning tree from the cache.
+  // @param key The cache key.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @return True if the key was found, false otherwise.
+  bool load(const string &key, vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Writes a spanning tree to the cache, replacing any entry with the same key.
+  // @param key The cache key.
+  // @param edges The edges (as pairs of node indices) of the tree.
+  // @param cost The costs associated with the edges.
+  // @return True on success, false otherwise.
+  bool store(const string &key, const vector<pair<int, int>> &edges, const vector<double> &cost);
+
+private:
+  // Gets the name of the file holding the given key.
+  string pathOf(const string &key);
+
+  // The directory holding the cache files.
+  string directory;
+
+};
+
+#endif // _HW3_MST_DISK_CACHE_H_
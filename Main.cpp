@@ -5,34 +5,251 @@
 
 #include <iostream>
 #include <numeric>
+#include <string>
+#include <cstdlib>
+#include <memory>
 
 #include "UndirectedGraph.hpp"
+#include "NodeReordering.hpp"
+#include "CompressedGraph.hpp"
+#include "DistributedMST.hpp"
+#include "PipelinedMST.hpp"
+#include "MSTDiskCache.hpp"
+#include "RandomizedMST.hpp"
 
 using namespace std;
 
-int main(int argc, char **argv)
+// Prints the total cost and the edges of a spanning tree.
+void printSpanningTree(const string &name, vector<pair<int, int>> &edges, vector<double> &cost)
 {
-  if (argc != 2) {
-    cerr << "Usage: " << argv[0] << " <filename>" << endl;
-    return 1;
-  }
+  cout << name << "'s algorithm's total cost: " << accumulate(cost.begin(), cost.end(), 0.0) << endl;
+  for (int i = 0; i < edges.size(); ++i)
+    cout << edges[i].first << " -> " << edges[i].second << " (" << cost[i] << ")" << endl;
+}
+
+// Runs one algorithm on the graph, or reads its result from the disk cache when there is one.
+// @param diskCache The cache of earlier results, or nullptr.
+// @param key The cache key of this result.
+// @param run The function computing the result as run(edges, cost).
+template <typename Runner>
+void runOrLoad(MSTDiskCache *diskCache, const string &key, vector<pair<int, int>> &edges, vector<double> &cost, Runner run)
+{
+  if (diskCache != nullptr && diskCache->load(key, edges, cost))
+    return;
+
+  run(edges, cost);
+  if (diskCache != nullptr && !diskCache->store(key, edges, cost))
+    cerr << "Could not write " << key << " to the cache" << endl;
+}
 
-  UndirectedGraph graph(argv[1]);
+// Runs both algorithms on the graph and prints their spanning trees.
+// @param reordering The node relabeling to undo on the results, if any.
+// @param queueType The priority queue the algorithms use.
+// @param numThreads The number of threads for Prim's algorithm; more than one runs the parallel version.
+// @param diskCache The cache of earlier results, or nullptr.
+// @param keyPrefix The part of the cache keys identifying the input and options.
+template <typename Graph>
+void runAlgorithms(Graph &graph, NodeReordering *reordering, QueueType queueType, int numThreads,
+                   MSTDiskCache *diskCache, const string &keyPrefix)
+{
   vector<pair<int, int>> edges;
   vector<double> cost;
 
-  graph.runPrimAlgorithm(edges, cost);
-  cout << "Prim's algorithm's total cost: " << accumulate(cost.begin(), cost.end(), 0.0) << endl;
-  for (int i = 0; i < edges.size(); ++i)
-    cout << edges[i].first << " -> " << edges[i].second << " (" << cost[i] << ")" << endl;
+  if (numThreads > 1) {
+    runOrLoad(diskCache, keyPrefix + ".parallelprim", edges, cost, [&](vector<pair<int, int>> &edges, vector<double> &cost) {
+      graph.runParallelPrimAlgorithm(edges, cost, numThreads);
+      if (reordering != nullptr) reordering->restore(edges);
+    });
+    printSpanningTree("Parallel Prim", edges, cost);
+  }
+  else {
+    runOrLoad(diskCache, keyPrefix + ".prim", edges, cost, [&](vector<pair<int, int>> &edges, vector<double> &cost) {
+      graph.runPrimAlgorithm(edges, cost, queueType);
+      if (reordering != nullptr) reordering->restore(edges);
+    });
+    printSpanningTree("Prim", edges, cost);
+  }
 
   cout << endl;
 
-  graph.runKruskalAlgorithm(edges, cost);
-  cout << "Kruskal's algorithm's total cost: " << accumulate(cost.begin(), cost.end(), 0.0) << endl;
-  for (int i = 0; i < edges.size(); ++i)
-    cout << edges[i].first << " -> " << edges[i].second << " (" << cost[i] << ")" << endl;
+  runOrLoad(diskCache, keyPrefix + ".kruskal", edges, cost, [&](vector<pair<int, int>> &edges, vector<double> &cost) {
+    graph.runKruskalAlgorithm(edges, cost, queueType);
+    if (reordering != nullptr) reordering->restore(edges);
+  });
+  printSpanningTree("Kruskal", edges, cost);
+}
 
-  return 0;
+// Runs the randomized algorithm on the graph and prints its spanning tree.
+// @param reordering The node relabeling to undo on the result, if any.
+// @param seed The seed of the random sampling.
+template <typename Graph>
+void runRandomizedAlgorithm(Graph &graph, NodeReordering *reordering, uint64_t seed)
+{
+  vector<pair<int, int>> edges;
+  vector<double> cost;
+
+  graph.runKargerKleinTarjanAlgorithm(edges, cost, seed);
+  if (reordering != nullptr) reordering->restore(edges);
+  cout << endl;
+  printSpanningTree("Karger-Klein-Tarjan", edges, cost);
 }
 
+int main(int argc, char **argv)
+{
+  ReorderingStrategy strategy = ReorderingStrategy::None;
+  const char *filename = nullptr;
+  bool compressed = false;
+  int numProcesses = 1;
+  int numThreads = 1;
+  bool pipelined = false;
+  bool randomized = false;
+  uint64_t seed = RandomizedMST::DefaultSeed;
+  QueueType queueType = QueueType::BinaryHeap;
+  const char *cacheDirectory = nullptr;
+  bool validArguments = true;
+
+  for (int i = 1; i < argc; ++i) {
+    string arg(argv[i]);
+    if (arg == "--reorder=bfs")
+      strategy = ReorderingStrategy::BreadthFirst;
+    else if (arg == "--reorder=rcm")
+      strategy = ReorderingStrategy::ReverseCuthillMcKee;
+    else if (arg == "--reorder=degree")
+      strategy = ReorderingStrategy::DegreeSorted;
+    else if (arg == "--compressed")
+      compressed = true;
+    else if (arg == "--queue=binary")
+      queueType = QueueType::BinaryHeap;
+    else if (arg == "--queue=radix")
+      queueType = QueueType::RadixHeap;
+    else if (arg == "--queue=bucket")
+      queueType = QueueType::BucketQueue;
+    else if (arg == "--randomized")
+      randomized = true;
+    else if (arg.compare(0, 7, "--seed=") == 0 && arg.size() > 7)
+      seed = strtoull(arg.c_str() + 7, nullptr, 10);
+    else if (arg == "--pipelined")
+      pipelined = true;
+    else if (arg.compare(0, 12, "--cache-dir=") == 0 && arg.size() > 12)
+      cacheDirectory = argv[i] + 12;
+    else if (arg.compare(0, 10, "--threads=") == 0 && atoi(arg.c_str() + 10) > 0)
+      numThreads = atoi(arg.c_str() + 10);
+    else if (arg.compare(0, 12, "--processes=") == 0 && atoi(arg.c_str() + 12) > 0)
+      numProcesses = atoi(arg.c_str() + 12);
+    else if (filename == nullptr && arg.compare(0, 2, "--") != 0)
+      filename = argv[i];
+    else
+      validArguments = false;
+  }
+
+  // the pipelined mode never holds the whole graph, so it takes no other options
+  if (pipelined && (strategy != ReorderingStrategy::None || compressed || numProcesses > 1 || numThreads > 1
+                    || randomized || cacheDirectory != nullptr))
+    validArguments = false;
+
+  // the distributed mode always runs Kruskal's algorithm over the reordered edge list in its
+  // worker processes, so the options for the in-process graphs do not apply to it
+  if (numProcesses > 1 && (compressed || numThreads > 1 || queueType != QueueType::BinaryHeap
+                           || randomized || cacheDirectory != nullptr))
+    validArguments = false;
+
+  if (!validArguments || filename == nullptr) {
+    cerr << "Usage: " << argv[0] << " [--reorder=bfs|rcm|degree] [--compressed] [--processes=N]" << endl
+       << "       [--threads=N] [--queue=binary|radix|bucket] [--randomized [--seed=N]]" << endl
+       << "       [--cache-dir=DIR] <filename>" << endl;
+    cerr << "       " << argv[0] << " --processes=N [--reorder=bfs|rcm|degree] <filename>" << endl;
+    cerr << "       " << argv[0] << " --pipelined <filename>" << endl;
+    return 1;
+  }
+
+  if (pipelined) {
+    PipelinedMST pipeline;
+    vector<pair<int, int>> edges;
+    vector<double> cost;
+    if (!pipeline.run(filename, edges, cost)) {
+      cerr << "Could not read " << filename << endl;
+      return 1;
+    }
+
+    cout << "Pipeline: " << pipeline.getNumChunks() << " chunks, load " << pipeline.getLoadSeconds()
+         << " s, merge " << pipeline.getComputeSeconds() << " s, total " << pipeline.getTotalSeconds() << " s" << endl << endl;
+    printSpanningTree("Pipelined Kruskal", edges, cost);
+    return 0;
+  }
+
+  // results are cached under the hash of the input and every option that can change the tree
+  unique_ptr<MSTDiskCache> diskCache;
+  string keyPrefix;
+  uint64_t contentHash;
+  if (cacheDirectory != nullptr && MSTDiskCache::hashFile(filename, contentHash)) {
+    static const char *strategyNames[] = { "none", "bfs", "rcm", "degree" };
+    static const char *queueNames[] = { "binary", "radix", "bucket" };
+    diskCache.reset(new MSTDiskCache(cacheDirectory));
+    keyPrefix = MSTDiskCache::makeKey(contentHash, string(strategyNames[int(strategy)]) + "."
+                                      + queueNames[int(queueType)] + (compressed ? ".compressed" : ".packed"));
+  }
+
+  if (strategy == ReorderingStrategy::None && !compressed && numProcesses == 1) {
+    UndirectedGraph graph(filename);
+    runAlgorithms(graph, nullptr, queueType, numThreads, diskCache.get(), keyPrefix);
+    if (randomized) runRandomizedAlgorithm(graph, nullptr, seed);
+    return 0;
+  }
+
+  if (strategy == ReorderingStrategy::None && compressed && numProcesses == 1) {
+    // read the file straight into the compressed rows, without holding its edge list
+    CompressedGraph graph(filename);
+    cout << "Compressed graph size: " << graph.getMemoryUsage() << " bytes" << endl << endl;
+    runAlgorithms(graph, nullptr, queueType, numThreads, diskCache.get(), keyPrefix);
+    if (randomized) runRandomizedAlgorithm(graph, nullptr, seed);
+    return 0;
+  }
+
+  // relabel the nodes before building the graph, and map the results back afterwards
+  int numNodes;
+  vector<WeightedEdge> edgeList;
+  UndirectedGraph::readEdgeList(filename, numNodes, edgeList);
+
+  NodeReordering reordering(numNodes, edgeList, strategy);
+  if (!reordering.isValid()) {
+    cerr << "Invalid node ID in " << filename << endl;
+    return 1;
+  }
+  reordering.relabel(edgeList);
+  if (strategy != ReorderingStrategy::None)
+    cout << "Reordering bandwidth: " << reordering.getBandwidthBefore() << " -> " << reordering.getBandwidthAfter()
+         << ", average edge span: " << reordering.getAverageSpanBefore() << " -> " << reordering.getAverageSpanAfter()
+         << endl << endl;
+
+  if (numProcesses > 1) {
+    UnixSocketTransport transport(numProcesses);
+    DistributedMST distributed(transport);
+    vector<pair<int, int>> edges;
+    vector<double> cost;
+    if (!distributed.run(numNodes, edgeList, edges, cost)) {
+      cerr << "Distributed computation failed" << endl;
+      return 1;
+    }
+
+    for (int round = 0; round < distributed.getNumRounds(); ++round)
+      cout << "Round " << round << ": " << distributed.getRoundSeconds(round) << " s, "
+           << distributed.getRoundBytes(round) << " bytes sent" << endl;
+    cout << endl;
+
+    reordering.restore(edges);
+    printSpanningTree("Distributed Kruskal", edges, cost);
+  }
+  else if (compressed) {
+    CompressedGraph graph(numNodes, edgeList);
+    cout << "Compressed graph size: " << graph.getMemoryUsage() << " bytes" << endl << endl;
+    runAlgorithms(graph, &reordering, queueType, numThreads, diskCache.get(), keyPrefix);
+    if (randomized) runRandomizedAlgorithm(graph, &reordering, seed);
+  }
+  else {
+    UndirectedGraph graph(numNodes, edgeList);
+    runAlgorithms(graph, &reordering, queueType, numThreads, diskCache.get(), keyPrefix);
+    if (randomized) runRandomizedAlgorithm(graph, &reordering, seed);
+  }
+
+  return 0;
+}
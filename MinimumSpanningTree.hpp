@@ -0,0 +1,404 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// MinimumSpanningTree.hpp
+
+#ifndef _HW3_MINIMUM_SPANNING_TREE_H_
+#define _HW3_MINIMUM_SPANNING_TREE_H_
+
+#include <vector>
+#include <unordered_set>
+#include <utility>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "PriorityQueue.hpp"
+#include "RadixHeap.hpp"
+#include "BucketQueue.hpp"
+#include "DisjointSet.hpp"
+
+using namespace std;
+
+// The priority queues the algorithms can use for their candidate edges.
+enum class QueueType
+{
+  BinaryHeap, // PriorityQueue; works for any edge values
+  RadixHeap, // RadixHeap; needs monotone removal, so only Kruskal's algorithm uses it
+  BucketQueue // BucketQueue; used when every edge value is exactly a multiple of 1, 0.1, ..., 0.0001
+              // (as read from a decimal), spanning at most MaxBuckets of those steps
+};
+
+// Lower edge values have higher priority, with ties broken by the lower and then the higher
+// node of each (node, node) element, so that no two distinct edges compare equal.
+class LowEdgesFirst
+{
+public:
+  template <typename T>
+  inline bool operator()(const T &lhs, const T &rhs) const
+  {
+    if (lhs.second != rhs.second) return lhs.second > rhs.second;
+    return minmax(lhs.first.first, lhs.first.second) > minmax(rhs.first.first, rhs.first.second);
+  }
+};
+
+// Minimum spanning tree algorithms shared by every graph representation. The graph type
+// must provide getNumNodes(), forEachNeighbor(node, visit), where visit is called as
+// visit(neighbor, edgeValue) for each node connected to the given node, and
+// forEachHigherNeighbor(node, visit), which does the same for the neighbors with a
+// higher index only.
+template <typename Graph>
+class MinimumSpanningTree
+{
+public:
+  // Run Prim's Algorithm to find the Minimum Spanning Tree of the graph; a graph with
+  // several components gets a tree for each, started from its lowest node.
+  // @param graph The graph to span.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use; falls back to the binary heap where the queue does not apply.
+  static void runPrimAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost,
+                               QueueType queueType = QueueType::BinaryHeap);
+
+  // Run Kruskal's Algorithm to find the Minimum Spanning Tree of the graph.
+  // @param graph The graph to span.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param queueType The priority queue to use; falls back to the binary heap where the queue does not apply.
+  static void runKruskalAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost,
+                                  QueueType queueType = QueueType::BinaryHeap);
+
+  // Run Prim's Algorithm from several seed nodes at once, one thread per group of seeds. Each
+  // thread grows a tree from a seed with its own heap until the tree's cheapest outgoing edge
+  // reaches a node claimed by another tree, then moves on to its next unclaimed seed; once
+  // every node is claimed, Kruskal's algorithm over the edges between trees joins them. Ties
+  // are broken by node index, so the result does not depend on the thread timing, and on
+  // distinct edge values it is the same tree as runPrimAlgorithm's. The graph is only read,
+  // from all the threads at once.
+  // @param graph The graph to span.
+  // @param edges The reference vector of edges (as pairs of node indices, lower node first), in increasing order of cost; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param numThreads The number of threads to use.
+  static void runParallelPrimAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost, int numThreads);
+
+  // The largest number of buckets a bucket queue may use.
+  static const int MaxBuckets = 1 << 20;
+
+private:
+  // Prim's Algorithm with the given (empty) priority queue.
+  template <typename Queue>
+  static void runPrimWithQueue(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost, Queue &pq);
+
+  // Kruskal's Algorithm with the given (empty) priority queue.
+  template <typename Queue>
+  static void runKruskalWithQueue(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost, Queue &pq);
+
+  // Grows a tree from each seed in a range that no other tree has claimed yet.
+  // @param owner The seed of the tree each node belongs to, or -1 while unclaimed.
+  // @param edges The edges of the trees are appended here.
+  // @param cost The costs of the edges are appended here.
+  static void growTrees(Graph &graph, vector<atomic<int>> &owner, int firstSeed, int lastSeed,
+                        vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Finds the value range and resolution of a bucket queue that can hold every edge of the graph,
+  // such that the edges in each bucket all have the same value.
+  // @return True if there is one with at most MaxBuckets buckets, false otherwise.
+  static bool findBucketRange(Graph &graph, double &minValue, double &maxValue, double &resolution);
+};
+
+// Method definitions placed here to avoid clutter.
+
+template <typename Graph>
+void MinimumSpanningTree<Graph>::runPrimAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost,
+                                                  QueueType queueType /*=QueueType::BinaryHeap*/)
+{
+  // the values Prim's algorithm removes go up and down, which a radix heap cannot handle
+  double minValue, maxValue, resolution;
+  if (queueType == QueueType::BucketQueue && findBucketRange(graph, minValue, maxValue, resolution)) {
+    BucketQueue<pair<int, int>, double> pq(minValue, maxValue, resolution);
+    runPrimWithQueue(graph, edges, cost, pq);
+  }
+  else {
+    PriorityQueue<pair<int, int>, double, LowValuesFirst> pq;
+    runPrimWithQueue(graph, edges, cost, pq);
+  }
+}
+
+template <typename Graph>
+void MinimumSpanningTree<Graph>::runKruskalAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost,
+                                                     QueueType queueType /*=QueueType::BinaryHeap*/)
+{
+  double minValue, maxValue, resolution;
+  if (queueType == QueueType::RadixHeap) {
+    RadixHeap<pair<int, int>, double> pq;
+    runKruskalWithQueue(graph, edges, cost, pq);
+  }
+  else if (queueType == QueueType::BucketQueue && findBucketRange(graph, minValue, maxValue, resolution)) {
+    BucketQueue<pair<int, int>, double> pq(minValue, maxValue, resolution);
+    runKruskalWithQueue(graph, edges, cost, pq);
+  }
+  else {
+    PriorityQueue<pair<int, int>, double, LowValuesFirst> pq;
+    runKruskalWithQueue(graph, edges, cost, pq);
+  }
+}
+
+template <typename Graph>
+template <typename Queue>
+void MinimumSpanningTree<Graph>::runPrimWithQueue(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost, Queue &pq)
+{
+  int numNodes = graph.getNumNodes();
+  if (numNodes == 0) return; // account for empty graph
+
+  edges.clear();
+  cost.clear();
+
+  unordered_set<int> visitedNodes;
+  double edgeValue;
+  pair<int, int> edge; // as a pair of nodes
+
+  visitedNodes.insert(0); // initialize the starting node
+  graph.forEachNeighbor(0, [&pq](int neighbor, double value) { // initialize candidate edges
+    pq.push(pair<int, int>(0, neighbor), value);
+  });
+
+  // repeat until we have visited all the nodes
+  int nextStart = 1;
+  while (visitedNodes.size() != numNodes) {
+    if (pq.empty()) {
+      // the tree spans its component; start the next tree from the lowest unvisited node
+      while (visitedNodes.count(nextStart) > 0) nextStart++;
+      int start = nextStart;
+      visitedNodes.insert(start);
+      graph.forEachNeighbor(start, [&pq, start](int neighbor, double value) {
+        pq.push(pair<int, int>(start, neighbor), value);
+      });
+      continue;
+    }
+
+    edgeValue = pq.getTopPriority();
+    edge = pq.pop();
+
+    // start again if we have already visited the destination node
+    if (visitedNodes.count(edge.second) > 0) continue;
+
+    visitedNodes.insert(edge.second); // mark the destination node as visited
+
+    // record the edge and its cost
+    cost.push_back(edgeValue);
+    edges.push_back(edge);
+
+    // add condidate edges, ignoring visited nodes
+    int node = edge.second;
+    graph.forEachNeighbor(node, [&pq, &visitedNodes, node](int neighbor, double value) {
+      if (visitedNodes.count(neighbor) == 0)
+        pq.push(pair<int, int>(node, neighbor), value);
+    });
+  }
+}
+
+template <typename Graph>
+template <typename Queue>
+void MinimumSpanningTree<Graph>::runKruskalWithQueue(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost, Queue &pq)
+{
+  int numNodes = graph.getNumNodes();
+  if (numNodes == 0) return; // account for empty graph
+
+  edges.clear();
+  cost.clear();
+
+  DisjointSet ds(numNodes);
+  double edgeValue;
+  pair<int, int> edge; // as a pair of nodes
+
+  // collect each edge once, from its lower numbered node
+  for (int i = 0; i < numNodes - 1; ++i) {
+    graph.forEachHigherNeighbor(i, [&pq, i](int neighbor, double value) {
+      pq.push(pair<int, int>(i, neighbor), value);
+    });
+  }
+
+  while (!pq.empty()) {
+    edgeValue = pq.getTopPriority();
+    edge = pq.pop();
+
+    if (!ds.isConnected(edge.first, edge.second)) {
+      // record the edge and its cost
+      cost.push_back(edgeValue);
+      edges.push_back(edge);
+
+      ds.merge(edge.first, edge.second); // connect the two sets
+    }
+  }
+}
+
+template <typename Graph>
+void MinimumSpanningTree<Graph>::runParallelPrimAlgorithm(Graph &graph, vector<pair<int, int>> &edges, vector<double> &cost,
+                                                          int numThreads)
+{
+  edges.clear();
+  cost.clear();
+
+  int numNodes = graph.getNumNodes();
+  if (numNodes == 0) return; // account for empty graph
+  numThreads = max(1, min(numThreads, numNodes));
+
+  vector<atomic<int>> owner(numNodes);
+  for (int i = 0; i < numNodes; ++i)
+    owner[i].store(-1, memory_order_relaxed);
+
+  // each thread takes its seeds from its own slice of the nodes, so the trees start apart
+  vector<vector<pair<pair<int, int>, double>>> crossingEdges(numThreads);
+  vector<vector<pair<int, int>>> treeEdges(numThreads);
+  vector<vector<double>> treeCost(numThreads);
+  vector<thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    int firstNode = int(int64_t(numNodes) * t / numThreads);
+    int lastNode = int(int64_t(numNodes) * (t + 1) / numThreads);
+    threads.push_back(thread([&graph, &owner, &treeEdges, &treeCost, t, firstNode, lastNode]() {
+      growTrees(graph, owner, firstNode, lastNode, treeEdges[t], treeCost[t]);
+    }));
+  }
+  for (thread &worker : threads)
+    worker.join();
+
+  // every edge of a tree is the cheapest edge leaving part of it, so it belongs to the
+  // minimum spanning forest; what is left is to join the trees, by their edges between them
+  threads.clear();
+  for (int t = 0; t < numThreads; ++t) {
+    int firstNode = int(int64_t(numNodes) * t / numThreads);
+    int lastNode = int(int64_t(numNodes) * (t + 1) / numThreads);
+    threads.push_back(thread([&graph, &owner, &crossingEdges, t, firstNode, lastNode]() {
+      for (int i = firstNode; i < lastNode; ++i) {
+        int tree = owner[i].load(memory_order_relaxed);
+        graph.forEachHigherNeighbor(i, [&](int neighbor, double value) {
+          if (owner[neighbor].load(memory_order_relaxed) != tree)
+            crossingEdges[t].push_back(pair<pair<int, int>, double>(pair<int, int>(i, neighbor), value));
+        });
+      }
+    }));
+  }
+  for (thread &worker : threads)
+    worker.join();
+
+  vector<pair<pair<int, int>, double>> result;
+  for (int t = 0; t < numThreads; ++t) {
+    for (size_t i = 0; i < treeEdges[t].size(); ++i)
+      result.push_back(pair<pair<int, int>, double>(treeEdges[t][i], treeCost[t][i]));
+    treeEdges[t].clear();
+    treeCost[t].clear();
+  }
+
+  vector<pair<pair<int, int>, double>> candidates;
+  for (int t = 0; t < numThreads; ++t) {
+    candidates.insert(candidates.end(), crossingEdges[t].begin(), crossingEdges[t].end());
+    crossingEdges[t].clear();
+  }
+
+  // Kruskal's algorithm over the trees, in the same total order the trees were grown in
+  LowEdgesFirst order;
+  auto ascending = [&order](const pair<pair<int, int>, double> &lhs, const pair<pair<int, int>, double> &rhs) {
+    return order(rhs, lhs);
+  };
+  sort(candidates.begin(), candidates.end(), ascending);
+  DisjointSet ds(numNodes);
+  for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+    int tree1 = owner[it->first.first].load(memory_order_relaxed);
+    int tree2 = owner[it->first.second].load(memory_order_relaxed);
+    if (!ds.isConnected(tree1, tree2)) {
+      result.push_back(*it);
+      ds.merge(tree1, tree2); // connect the two sets
+    }
+  }
+
+  // list the edges lower node first, cheapest first
+  for (auto it = result.begin(); it != result.end(); ++it) {
+    if (it->first.first > it->first.second)
+      swap(it->first.first, it->first.second);
+  }
+  sort(result.begin(), result.end(), ascending);
+  for (auto it = result.begin(); it != result.end(); ++it) {
+    edges.push_back(it->first);
+    cost.push_back(it->second);
+  }
+}
+
+template <typename Graph>
+void MinimumSpanningTree<Graph>::growTrees(Graph &graph, vector<atomic<int>> &owner, int firstSeed, int lastSeed,
+                                           vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  PriorityQueue<pair<int, int>, double, LowEdgesFirst> pq;
+  double edgeValue;
+  pair<int, int> edge; // as a pair of nodes
+
+  for (int seed = firstSeed; seed < lastSeed; ++seed) {
+    int unclaimed = -1;
+    if (!owner[seed].compare_exchange_strong(unclaimed, seed)) continue; // already in a tree
+
+    // the seed names the tree
+    auto addCandidates = [&graph, &owner, &pq, seed](int node) {
+      graph.forEachNeighbor(node, [&owner, &pq, seed, node](int neighbor, double value) {
+        if (owner[neighbor].load(memory_order_relaxed) != seed)
+          pq.push(pair<int, int>(node, neighbor), value);
+      });
+    };
+    addCandidates(seed);
+
+    while (!pq.empty()) {
+      edgeValue = pq.getTopPriority();
+      edge = pq.pop();
+
+      // start again if the destination node is already in this tree
+      int destinationOwner = owner[edge.second].load();
+      if (destinationOwner == seed) continue;
+
+      // stop growing once the cheapest way out of this tree leads into another one
+      unclaimed = -1;
+      if (destinationOwner != -1 || !owner[edge.second].compare_exchange_strong(unclaimed, seed))
+        break;
+
+      // record the edge and its cost
+      cost.push_back(edgeValue);
+      edges.push_back(edge);
+
+      addCandidates(edge.second);
+    }
+    pq.clear();
+  }
+}
+
+template <typename Graph>
+bool MinimumSpanningTree<Graph>::findBucketRange(Graph &graph, double &minValue, double &maxValue, double &resolution)
+{
+  // check every candidate resolution in a single pass over the edges; a value fits one only if
+  // it is exactly the double nearest to a whole number of steps, so that two different values
+  // are never rounded into the same bucket, where they would come out in the wrong order
+  const int numResolutions = 5;
+  const double stepsPerUnit[numResolutions] = { 1.0, 10.0, 100.0, 1000.0, 10000.0 };
+  bool fits[numResolutions] = { true, true, true, true, true };
+  bool anyEdges = false;
+
+  for (int i = 0; i < graph.getNumNodes(); ++i) {
+    graph.forEachNeighbor(i, [&](int, double value) {
+      if (!anyEdges)
+        minValue = maxValue = value;
+      anyEdges = true;
+      minValue = min(minValue, value);
+      maxValue = max(maxValue, value);
+      for (int r = 0; r < numResolutions; ++r)
+        fits[r] = fits[r] && round(value * stepsPerUnit[r]) / stepsPerUnit[r] == value;
+    });
+  }
+
+  if (!anyEdges) return false;
+
+  for (int r = 0; r < numResolutions; ++r) {
+    if (fits[r] && (maxValue - minValue) * stepsPerUnit[r] < MaxBuckets) {
+      resolution = 1.0 / stepsPerUnit[r];
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif // _HW3_MINIMUM_SPANNING_TREE_H_
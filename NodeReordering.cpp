@@ -0,0 +1,154 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// NodeReordering.cpp
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "NodeReordering.hpp"
+
+NodeReordering::NodeReordering(int numNodes, const vector<WeightedEdge> &edgeList, ReorderingStrategy strategy)
+{
+  this->numNodes = numNodes;
+  bandwidthBefore = bandwidthAfter = 0;
+  averageSpanBefore = averageSpanAfter = 0.0;
+
+  // every ID must be a node, as the rows below are indexed by them; otherwise keep the IDs
+  valid = (numNodes >= 0);
+  for (auto it = edgeList.begin(); valid && it != edgeList.end(); ++it) {
+    if (it->node1 < 0 || it->node1 >= numNodes || it->node2 < 0 || it->node2 >= numNodes)
+      valid = false;
+  }
+  if (!valid) {
+    for (int i = 0; i < numNodes; ++i) {
+      newIDs.push_back(i);
+      originalIDs.push_back(i);
+    }
+    return;
+  }
+
+  // count the degree of each node, then place each node's neighbors in its row
+  rowOffsets.assign(numNodes + 1, 0);
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    rowOffsets[it->node1 + 1]++;
+    rowOffsets[it->node2 + 1]++;
+  }
+  for (int i = 0; i < numNodes; ++i)
+    rowOffsets[i + 1] += rowOffsets[i];
+
+  adjacentNodes.resize(rowOffsets[numNodes]);
+  vector<int> next(rowOffsets.begin(), rowOffsets.end() - 1);
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    adjacentNodes[next[it->node1]++] = it->node2;
+    adjacentNodes[next[it->node2]++] = it->node1;
+  }
+
+  // the order lists the original node IDs in their new sequence
+  vector<int> order;
+  switch (strategy) {
+  case ReorderingStrategy::BreadthFirst:
+    orderBreadthFirst(false, order);
+    break;
+  case ReorderingStrategy::ReverseCuthillMcKee:
+    orderBreadthFirst(true, order);
+    reverse(order.begin(), order.end());
+    break;
+  case ReorderingStrategy::DegreeSorted:
+    orderByDegree(order);
+    break;
+  default:
+    for (int i = 0; i < numNodes; ++i)
+      order.push_back(i);
+    break;
+  }
+
+  originalIDs = order;
+  newIDs.resize(numNodes);
+  for (int i = 0; i < numNodes; ++i)
+    newIDs[originalIDs[i]] = i;
+
+  vector<int> identity(numNodes);
+  for (int i = 0; i < numNodes; ++i)
+    identity[i] = i;
+  measureLocality(edgeList, identity, bandwidthBefore, averageSpanBefore);
+  measureLocality(edgeList, newIDs, bandwidthAfter, averageSpanAfter);
+}
+
+void NodeReordering::relabel(vector<WeightedEdge> &edgeList)
+{
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    it->node1 = newIDs[it->node1];
+    it->node2 = newIDs[it->node2];
+  }
+}
+
+void NodeReordering::restore(vector<pair<int, int>> &edges)
+{
+  for (auto it = edges.begin(); it != edges.end(); ++it) {
+    it->first = originalIDs[it->first];
+    it->second = originalIDs[it->second];
+  }
+}
+
+void NodeReordering::orderBreadthFirst(bool lowDegreeFirst, vector<int> &order)
+{
+  vector<bool> visited(numNodes, false);
+  vector<int> candidates(numNodes);
+  for (int i = 0; i < numNodes; ++i)
+    candidates[i] = i;
+
+  // Cuthill-McKee starts each component at one of its lowest degree nodes
+  auto byDegree = [this](int a, int b) {
+    return rowOffsets[a + 1] - rowOffsets[a] < rowOffsets[b + 1] - rowOffsets[b];
+  };
+  if (lowDegreeFirst)
+    stable_sort(candidates.begin(), candidates.end(), byDegree);
+
+  order.clear();
+  order.reserve(numNodes);
+  vector<int> neighbors;
+  for (auto start = candidates.begin(); start != candidates.end(); ++start) {
+    if (visited[*start]) continue;
+
+    // the order itself serves as the queue of the traversal
+    size_t head = order.size();
+    visited[*start] = true;
+    order.push_back(*start);
+    while (head < order.size()) {
+      int node = order[head++];
+      neighbors.assign(adjacentNodes.begin() + rowOffsets[node], adjacentNodes.begin() + rowOffsets[node + 1]);
+      if (lowDegreeFirst)
+        stable_sort(neighbors.begin(), neighbors.end(), byDegree);
+
+      for (auto it = neighbors.begin(); it != neighbors.end(); ++it) {
+        if (!visited[*it]) {
+          visited[*it] = true;
+          order.push_back(*it);
+        }
+      }
+    }
+  }
+}
+
+void NodeReordering::orderByDegree(vector<int> &order)
+{
+  order.resize(numNodes);
+  for (int i = 0; i < numNodes; ++i)
+    order[i] = i;
+
+  stable_sort(order.begin(), order.end(), [this](int a, int b) {
+    return rowOffsets[a + 1] - rowOffsets[a] > rowOffsets[b + 1] - rowOffsets[b];
+  });
+}
+
+void NodeReordering::measureLocality(const vector<WeightedEdge> &edgeList, const vector<int> &labels,
+                                     int &bandwidth, double &averageSpan)
+{
+  bandwidth = 0;
+  double totalSpan = 0.0;
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it) {
+    int span = abs(labels[it->node1] - labels[it->node2]);
+    bandwidth = max(bandwidth, span);
+    totalSpan += span;
+  }
+  averageSpan = edgeList.empty() ? 0.0 : totalSpan / edgeList.size();
+}
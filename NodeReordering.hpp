@@ -0,0 +1,147 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// NodeReordering.hpp
+
+#ifndef _HW3_NODE_REORDERING_H_
+#define _HW3_NODE_REORDERING_H_
+
+#include <vector>
+#include <utility>
+
+#include "UndirectedGraph.hpp"
+
+using namespace std;
+
+// The available node orderings.
+enum class ReorderingStrategy
+{
+  None, // keep the original node IDs
+  BreadthFirst, // breadth-first order, one component at a time
+  ReverseCuthillMcKee, // breadth-first order from a low-degree node, visiting low-degree neighbors first, reversed
+  DegreeSorted // highest degree first
+};
+
+// Relabels the nodes of an edge list so that connected nodes get nearby IDs; applied
+// before the graph is built, with the results mapped back to the original IDs afterwards.
+class NodeReordering
+{
+public:
+  // Constructor; computes the new node IDs for the given edge list. If an edge refers to a node
+  // outside 0 to numNodes - 1 the edge list is rejected: every node keeps its ID, and isValid()
+  // returns false.
+  // @param numNodes The number of nodes.
+  // @param edgeList The edges, using the original node IDs.
+  // @param strategy The ordering to use.
+  NodeReordering(int numNodes, const vector<WeightedEdge> &edgeList, ReorderingStrategy strategy);
+
+  // Checks whether the edge list given to the constructor was accepted.
+  // @return True if every edge referred to nodes 0 to numNodes - 1.
+  bool isValid();
+
+  // Gets the new ID of a node.
+  // @param originalID The original node ID.
+  // @return The new node ID.
+  int getNewID(int originalID);
+
+  // Gets the original ID of a node.
+  // @param newID The new node ID.
+  // @return The original node ID.
+  int getOriginalID(int newID);
+
+  // Relabels the edges from the original node IDs to the new node IDs; only for a valid reordering.
+  // @param edgeList The reference vector of edges to relabel in place.
+  void relabel(vector<WeightedEdge> &edgeList);
+
+  // Maps edges computed on the reordered graph back to the original node IDs.
+  // @param edges The reference vector of edges (as pairs of node indices) to restore in place.
+  void restore(vector<pair<int, int>> &edges);
+
+  // Gets the bandwidth (largest ID difference between connected nodes) of the original order.
+  // @return The bandwidth before reordering.
+  int getBandwidthBefore();
+
+  // Gets the bandwidth (largest ID difference between connected nodes) of the new order.
+  // @return The bandwidth after reordering.
+  int getBandwidthAfter();
+
+  // Gets the average ID difference between connected nodes in the original order.
+  // @return The average edge span before reordering.
+  double getAverageSpanBefore();
+
+  // Gets the average ID difference between connected nodes in the new order.
+  // @return The average edge span after reordering.
+  double getAverageSpanAfter();
+
+private:
+  // Fills the order with a breadth-first traversal of every component.
+  // @param lowDegreeFirst True to start each component at its lowest degree node and
+  //                       visit neighbors by increasing degree (Cuthill-McKee).
+  void orderBreadthFirst(bool lowDegreeFirst, vector<int> &order);
+
+  // Fills the order with the nodes sorted by decreasing degree.
+  void orderByDegree(vector<int> &order);
+
+  // Computes the bandwidth and average edge span of the edges under the given labeling.
+  void measureLocality(const vector<WeightedEdge> &edgeList, const vector<int> &labels,
+                       int &bandwidth, double &averageSpan);
+
+  // The number of nodes.
+  int numNodes;
+
+  // True if the edge list was accepted.
+  bool valid;
+
+  // The neighbors of every node, in compressed row form: the neighbors of
+  // node i are adjacentNodes[rowOffsets[i]] to adjacentNodes[rowOffsets[i + 1] - 1].
+  vector<int> rowOffsets;
+  vector<int> adjacentNodes;
+
+  // Maps each original node ID to its new ID, and back.
+  vector<int> newIDs;
+  vector<int> originalIDs;
+
+  // The locality metrics of the original and the new order.
+  int bandwidthBefore;
+  int bandwidthAfter;
+  double averageSpanBefore;
+  double averageSpanAfter;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline bool NodeReordering::isValid()
+{
+  return valid;
+}
+
+inline int NodeReordering::getNewID(int originalID)
+{
+  return newIDs[originalID];
+}
+
+inline int NodeReordering::getOriginalID(int newID)
+{
+  return originalIDs[newID];
+}
+
+inline int NodeReordering::getBandwidthBefore()
+{
+  return bandwidthBefore;
+}
+
+inline int NodeReordering::getBandwidthAfter()
+{
+  return bandwidthAfter;
+}
+
+inline double NodeReordering::getAverageSpanBefore()
+{
+  return averageSpanBefore;
+}
+
+inline double NodeReordering::getAverageSpanAfter()
+{
+  return averageSpanAfter;
+}
+
+#endif // _HW3_NODE_REORDERING_H_
@@ -0,0 +1,126 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// PackedSymmetricMatrix.cpp
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+
+#include "PackedSymmetricMatrix.hpp"
+
+PackedSymmetricMatrix::PackedSymmetricMatrix()
+{
+  size = 0;
+  allocate();
+}
+
+PackedSymmetricMatrix::PackedSymmetricMatrix(int size)
+{
+  this->size = size;
+  allocate();
+}
+
+PackedSymmetricMatrix::PackedSymmetricMatrix(const PackedSymmetricMatrix &other)
+{
+  size = other.size;
+  allocate();
+  if (allocatedBytes > 0) {
+    memcpy(entries, other.entries, allocatedBytes);
+    memcpy(nonzeroMasks, other.nonzeroMasks, maskBytes);
+  }
+}
+
+PackedSymmetricMatrix& PackedSymmetricMatrix::operator=(const PackedSymmetricMatrix &other)
+{
+  if (this != &other) {
+    release();
+    size = other.size;
+    allocate();
+    if (allocatedBytes > 0) {
+      memcpy(entries, other.entries, allocatedBytes);
+      memcpy(nonzeroMasks, other.nonzeroMasks, maskBytes);
+    }
+  }
+  return *this;
+}
+
+PackedSymmetricMatrix::~PackedSymmetricMatrix()
+{
+  release();
+}
+
+void PackedSymmetricMatrix::resize(int size)
+{
+  release();
+  this->size = size;
+  allocate();
+}
+
+void PackedSymmetricMatrix::allocate()
+{
+  size_t bytes = size_t(size) * (size_t(size) + 1) / 2 * sizeof(double);
+  entries = nullptr;
+  nonzeroMasks = nullptr;
+  allocatedBytes = maskBytes = 0;
+  mapped = masksMapped = false;
+  wordsPerRow = (size + 63) / 64;
+  if (bytes == 0) return;
+
+  entries = static_cast<double*>(allocateZeroed(bytes, mapped));
+  if (entries != nullptr) {
+    allocatedBytes = bytes;
+    maskBytes = size_t(size) * wordsPerRow * sizeof(uint64_t);
+    nonzeroMasks = static_cast<uint64_t*>(allocateZeroed(maskBytes, masksMapped));
+  }
+
+  // leave an empty matrix behind, as the vectors this replaced would have
+  if (nonzeroMasks == nullptr) {
+    release();
+    size = 0;
+    wordsPerRow = 0;
+    throw bad_alloc();
+  }
+}
+
+void PackedSymmetricMatrix::release()
+{
+  if (entries != nullptr)
+    releaseZeroed(entries, allocatedBytes, mapped);
+  if (nonzeroMasks != nullptr)
+    releaseZeroed(nonzeroMasks, maskBytes, masksMapped);
+  entries = nullptr;
+  nonzeroMasks = nullptr;
+  allocatedBytes = maskBytes = 0;
+  mapped = masksMapped = false;
+}
+
+void* PackedSymmetricMatrix::allocateZeroed(size_t bytes, bool &mapped)
+{
+  mapped = false;
+  if (bytes >= MappingThreshold) {
+    // mapped pages are page aligned and read as zero until they are first written
+    void *memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+      madvise(memory, bytes, MADV_HUGEPAGE);
+#endif
+      mapped = true;
+      return memory;
+    }
+  }
+
+  // aligned_alloc needs a multiple of the alignment
+  size_t roundedBytes = (bytes + Alignment - 1) / Alignment * Alignment;
+  void *memory = aligned_alloc(Alignment, roundedBytes);
+  if (memory != nullptr)
+    memset(memory, 0, roundedBytes);
+  return memory;
+}
+
+void PackedSymmetricMatrix::releaseZeroed(void *memory, size_t bytes, bool mapped)
+{
+  if (mapped)
+    munmap(memory, bytes);
+  else
+    free(memory);
+}
@@ -0,0 +1,230 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// PackedSymmetricMatrix.hpp
+
+#ifndef _HW3_PACKED_SYMMETRIC_MATRIX_H_
+#define _HW3_PACKED_SYMMETRIC_MATRIX_H_
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+
+// A symmetric n x n matrix of doubles that stores only its upper triangle (including the
+// diagonal), row after row, in one zero-initialized, 64-byte aligned allocation. Large
+// matrices are mapped directly from the operating system, so their pages are only touched
+// when written, and are marked as candidates for huge pages. A full n x n bit mask of the
+// nonzero entries, one bit per entry, is kept alongside, so a whole row's nonzero entries
+// can be found by reading its mask in order.
+class PackedSymmetricMatrix
+{
+public:
+  // Constructor; creates an empty matrix.
+  PackedSymmetricMatrix();
+
+  // Constructor; creates an n x n matrix of zeros.
+  // @param size The number of rows and columns (n).
+  PackedSymmetricMatrix(int size);
+
+  // Copy constructor.
+  PackedSymmetricMatrix(const PackedSymmetricMatrix &other);
+
+  // Copy assignment.
+  PackedSymmetricMatrix& operator=(const PackedSymmetricMatrix &other);
+
+  // Destructor.
+  ~PackedSymmetricMatrix();
+
+  // Replaces the matrix with an n x n matrix of zeros.
+  // @param size The number of rows and columns (n).
+  void resize(int size);
+
+  // Gets the number of rows and columns.
+  // @return The size of the matrix.
+  int getSize() const;
+
+  // Gets the entry at the given row and column; the same as at the column and row.
+  // @param row The row index.
+  // @param column The column index.
+  // @return The value of the entry.
+  double get(int row, int column) const;
+
+  // Sets the entry at the given row and column, and so also at the column and row.
+  // @param row The row index.
+  // @param column The column index.
+  // @param value The value to set.
+  void set(int row, int column, double value);
+
+  // Calls the visitor for every entry of a row, in column order. The columns below the
+  // diagonal are read with a shrinking stride, the rest sequentially.
+  // @param row The row index.
+  // @param visit The function called as visit(column, value) for each entry.
+  template <typename Visitor>
+  void forEachInRow(int row, Visitor visit) const;
+
+  // Calls the visitor for every nonzero entry of a row, in column order. The row's mask is read
+  // sequentially, and only the entries it marks are fetched, which below the diagonal saves a
+  // cache line for each zero.
+  // @param row The row index.
+  // @param visit The function called as visit(column, value) for each nonzero entry.
+  template <typename Visitor>
+  void forEachNonzeroInRow(int row, Visitor visit) const;
+
+  // Calls the visitor for every nonzero entry of a row to the right of the diagonal, in column
+  // order, finding them with the row's mask as forEachNonzeroInRow() does.
+  // @param row The row index.
+  // @param visit The function called as visit(column, value) for each nonzero entry.
+  template <typename Visitor>
+  void forEachNonzeroAboveDiagonal(int row, Visitor visit) const;
+
+  // Calls the visitor for every entry of a row to the right of the diagonal, in column order;
+  // these are stored sequentially, and together cover each off-diagonal pair exactly once.
+  // @param row The row index.
+  // @param visit The function called as visit(column, value) for each entry.
+  template <typename Visitor>
+  void forEachAboveDiagonal(int row, Visitor visit) const;
+
+  // Gets the number of bytes allocated for the entries and the nonzero mask.
+  // @return The memory used, in bytes.
+  size_t getMemoryUsage() const;
+
+private:
+  // The alignment of the entries (a cache line).
+  static const size_t Alignment = 64;
+
+  // Allocations of at least this many bytes are mapped directly (the size of a huge page).
+  static const size_t MappingThreshold = size_t(2) << 20;
+
+  // Gets the position of the given entry in the packed array; requires row <= column.
+  size_t indexOf(int row, int column) const;
+
+  // Allocates the zeroed storage for the current size.
+  void allocate();
+
+  // Frees the storage.
+  void release();
+
+  // Allocates zeroed, aligned memory, mapping it directly if it is large.
+  // @param bytes The number of bytes; must not be zero.
+  // @param mapped Set to true if the memory was mapped rather than allocated.
+  // @return The memory, or nullptr if it could not be allocated.
+  static void* allocateZeroed(size_t bytes, bool &mapped);
+
+  // Frees memory from allocateZeroed().
+  static void releaseZeroed(void *memory, size_t bytes, bool mapped);
+
+  // The number of rows and columns.
+  int size;
+
+  // The packed upper triangle, and the number of bytes allocated for it.
+  double *entries;
+  size_t allocatedBytes;
+
+  // Bit (column % 64) of nonzeroMasks[row * wordsPerRow + column / 64] is set if the entry is
+  // nonzero; both orientations are set. Also the number of bytes allocated for the masks.
+  uint64_t *nonzeroMasks;
+  int wordsPerRow;
+  size_t maskBytes;
+
+  // True if the entries or the masks were mapped from the operating system rather than allocated.
+  bool mapped;
+  bool masksMapped;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline int PackedSymmetricMatrix::getSize() const
+{
+  return size;
+}
+
+inline size_t PackedSymmetricMatrix::getMemoryUsage() const
+{
+  return allocatedBytes + maskBytes;
+}
+
+inline size_t PackedSymmetricMatrix::indexOf(int row, int column) const
+{
+  // rows 0 to row - 1 hold size, size - 1, ... entries
+  return size_t(row) * (2 * size_t(size) - row + 1) / 2 + (column - row);
+}
+
+inline double PackedSymmetricMatrix::get(int row, int column) const
+{
+  return row <= column ? entries[indexOf(row, column)] : entries[indexOf(column, row)];
+}
+
+inline void PackedSymmetricMatrix::set(int row, int column, double value)
+{
+  if (row <= column)
+    entries[indexOf(row, column)] = value;
+  else
+    entries[indexOf(column, row)] = value;
+
+  uint64_t &rowWord = nonzeroMasks[size_t(row) * wordsPerRow + column / 64];
+  uint64_t &columnWord = nonzeroMasks[size_t(column) * wordsPerRow + row / 64];
+  if (value != 0.0) {
+    rowWord |= uint64_t(1) << (column % 64);
+    columnWord |= uint64_t(1) << (row % 64);
+  }
+  else {
+    rowWord &= ~(uint64_t(1) << (column % 64));
+    columnWord &= ~(uint64_t(1) << (row % 64));
+  }
+}
+
+template <typename Visitor>
+inline void PackedSymmetricMatrix::forEachInRow(int row, Visitor visit) const
+{
+  // below the diagonal, the entry for (row, column) sits in row "column" of the packed
+  // triangle; moving to the next column skips the rest of that packed row
+  const double *entry = entries + row;
+  for (int column = 0; column < row; ++column) {
+    visit(column, *entry);
+    entry += size - column - 1;
+  }
+
+  const double *rowEntries = entries + indexOf(row, row);
+  for (int column = row; column < size; ++column)
+    visit(column, rowEntries[column - row]);
+}
+
+template <typename Visitor>
+inline void PackedSymmetricMatrix::forEachNonzeroInRow(int row, Visitor visit) const
+{
+  const uint64_t *mask = nonzeroMasks + size_t(row) * wordsPerRow;
+  for (int word = 0; word < wordsPerRow; ++word) {
+    for (uint64_t bits = mask[word]; bits != 0; bits &= bits - 1) {
+      int column = word * 64 + __builtin_ctzll(bits);
+      visit(column, get(row, column));
+    }
+  }
+}
+
+template <typename Visitor>
+inline void PackedSymmetricMatrix::forEachNonzeroAboveDiagonal(int row, Visitor visit) const
+{
+  // the entries are stored sequentially from the diagonal
+  const uint64_t *mask = nonzeroMasks + size_t(row) * wordsPerRow;
+  const double *rowEntries = entries + indexOf(row, row) - row;
+  int firstColumn = row + 1;
+  for (int word = firstColumn / 64; word < wordsPerRow; ++word) {
+    uint64_t bits = mask[word];
+    if (word == firstColumn / 64)
+      bits &= ~uint64_t(0) << (firstColumn % 64);
+    for (; bits != 0; bits &= bits - 1) {
+      int column = word * 64 + __builtin_ctzll(bits);
+      visit(column, rowEntries[column]);
+    }
+  }
+}
+
+template <typename Visitor>
+inline void PackedSymmetricMatrix::forEachAboveDiagonal(int row, Visitor visit) const
+{
+  const double *rowEntries = entries + indexOf(row, row);
+  for (int column = row + 1; column < size; ++column)
+    visit(column, rowEntries[column - row]);
+}
+
+#endif // _HW3_PACKED_SYMMETRIC_MATRIX_H_
@@ -0,0 +1,209 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// PipelinedMST.cpp
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "PipelinedMST.hpp"
+#include "SpanningForest.hpp"
+
+PipelinedMST::PipelinedMST(int numProducers /*=2*/, size_t chunkSize /*=65536*/, size_t queueCapacity /*=8*/)
+{
+  this->numProducers = max(numProducers, 1);
+  this->chunkSize = max(chunkSize, size_t(1));
+  this->queueCapacity = max(queueCapacity, size_t(1));
+  loadSeconds = computeSeconds = totalSeconds = 0.0;
+  numChunks = 0;
+}
+
+bool PipelinedMST::run(const char* filename, vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  auto start = chrono::steady_clock::now();
+  loadSeconds = computeSeconds = totalSeconds = 0.0;
+  numChunks = 0;
+  edges.clear();
+  cost.clear();
+
+  // read the number of nodes, then split the rest of the file between the producers
+  ifstream infile(filename);
+  int numNodes;
+  if (!(infile >> numNodes) || numNodes < 0) return false;
+  streamoff dataStart = infile.tellg();
+  infile.seekg(0, ios::end);
+  streamoff dataEnd = infile.tellg();
+  infile.close();
+
+  // first scan: mark the node pair of every line in a filter; a line whose bits are all
+  // set already may repeat an earlier pair, and its key is kept
+  vector<atomic<uint64_t>> filter(max<streamoff>((dataEnd - dataStart + 63) / 64, 1));
+  vector<vector<uint64_t>> repeatedKeys(numProducers);
+  atomic<bool> producerFailed(false);
+  vector<thread> producers;
+  for (int i = 0; i < numProducers; ++i) {
+    streamoff first = dataStart + (dataEnd - dataStart) * i / numProducers;
+    streamoff last = dataStart + (dataEnd - dataStart) * (i + 1) / numProducers;
+    producers.push_back(thread([this, filename, numNodes, first, last, &filter, &repeatedKeys, &producerFailed, i] {
+      bool read = readRange(filename, numNodes, first, last, [&](const WeightedEdge &edge, streamoff) {
+        // two bits of one word, so that of two lines of a pair the later one always sees both
+        uint64_t key = PairKey(edge);
+        uint64_t hash = key + 0x9e3779b97f4a7c15ULL; // splitmix64 finalizer
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        uint64_t mask = (uint64_t(1) << (hash >> 58)) | (uint64_t(1) << ((hash >> 52) & 63));
+        if ((filter[hash % filter.size()].fetch_or(mask) & mask) == mask)
+          repeatedKeys[i].push_back(key);
+      });
+      if (!read)
+        producerFailed = true;
+    }));
+  }
+  for (auto it = producers.begin(); it != producers.end(); ++it)
+    it->join();
+  producers.clear();
+  vector<atomic<uint64_t>>().swap(filter);
+  if (producerFailed) {
+    totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return false;
+  }
+
+  vector<uint64_t> heldKeys;
+  for (auto it = repeatedKeys.begin(); it != repeatedKeys.end(); ++it) {
+    heldKeys.insert(heldKeys.end(), it->begin(), it->end());
+    vector<uint64_t>().swap(*it);
+  }
+  sort(heldKeys.begin(), heldKeys.end());
+  heldKeys.erase(unique(heldKeys.begin(), heldKeys.end()), heldKeys.end());
+
+  // second scan: pass the lines of the other pairs on in chunks, leaving out those of
+  // distance 0.0, and hold back the lines of the pairs that may repeat with their positions
+  BoundedQueue<vector<WeightedEdge>> queue(queueCapacity);
+  atomic<int> activeProducers(numProducers);
+  vector<vector<pair<streamoff, WeightedEdge>>> heldLines(numProducers);
+  for (int i = 0; i < numProducers; ++i) {
+    streamoff first = dataStart + (dataEnd - dataStart) * i / numProducers;
+    streamoff last = dataStart + (dataEnd - dataStart) * (i + 1) / numProducers;
+    producers.push_back(thread([this, filename, numNodes, first, last, start, i, &heldKeys, &heldLines, &queue,
+                                &activeProducers, &producerFailed] {
+      vector<WeightedEdge> chunk;
+      chunk.reserve(chunkSize);
+      bool read = readRange(filename, numNodes, first, last, [&](const WeightedEdge &edge, streamoff position) {
+        if (binary_search(heldKeys.begin(), heldKeys.end(), PairKey(edge)))
+          heldLines[i].push_back(pair<streamoff, WeightedEdge>(position, edge));
+        else if (edge.value != 0.0) {
+          chunk.push_back(edge);
+          if (chunk.size() == chunkSize) {
+            queue.push(move(chunk));
+            chunk = vector<WeightedEdge>();
+            chunk.reserve(chunkSize);
+          }
+        }
+      });
+      if (!chunk.empty())
+        queue.push(move(chunk));
+      if (!read)
+        producerFailed = true;
+      if (--activeProducers == 0) { // the last producer to finish ends the input
+        loadSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        queue.close();
+      }
+    }));
+  }
+
+  // merge the chunks as they arrive; merging costs time proportional to the forest size,
+  // so wait until at least that many edges are pending
+  SpanningForest forest(numNodes);
+  vector<WeightedEdge> chunk;
+  vector<WeightedEdge> pending;
+  size_t mergeThreshold = max(chunkSize, size_t(numNodes));
+  bool moreChunks = true;
+  while (moreChunks) {
+    moreChunks = queue.pop(chunk);
+    if (moreChunks) {
+      numChunks++;
+      pending.insert(pending.end(), chunk.begin(), chunk.end());
+    }
+
+    if (pending.size() >= mergeThreshold || (!moreChunks && !pending.empty())) {
+      auto mergeStart = chrono::steady_clock::now();
+      forest.merge(pending);
+      pending.clear();
+      computeSeconds += chrono::duration<double>(chrono::steady_clock::now() - mergeStart).count();
+    }
+  }
+
+  for (auto it = producers.begin(); it != producers.end(); ++it)
+    it->join();
+
+  if (producerFailed) { // the forest is missing the edges that were not read
+    totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return false;
+  }
+
+  // the held back lines, in file order, resolve to the last distance of each pair
+  auto mergeStart = chrono::steady_clock::now();
+  vector<pair<streamoff, WeightedEdge>> held;
+  for (auto it = heldLines.begin(); it != heldLines.end(); ++it)
+    held.insert(held.end(), it->begin(), it->end());
+  sort(held.begin(), held.end(), [](const pair<streamoff, WeightedEdge> &lhs, const pair<streamoff, WeightedEdge> &rhs) {
+    return lhs.first < rhs.first;
+  });
+  for (auto it = held.begin(); it != held.end(); ++it)
+    pending.push_back(it->second);
+  UndirectedGraph::resolveEdgeList(pending);
+  if (!pending.empty())
+    forest.merge(pending);
+  computeSeconds += chrono::duration<double>(chrono::steady_clock::now() - mergeStart).count();
+
+  totalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  forest.getSpanningTree(edges, cost);
+  return true;
+}
+
+template <typename Visitor>
+bool PipelinedMST::readRange(const char* filename, int numNodes, streamoff first, streamoff last, Visitor visit)
+{
+  ifstream infile(filename);
+  if (!infile) return false;
+
+  // skip the rest of the line that the previous range's producer owns; the
+  // first range starts at the end of the line holding the number of nodes
+  string line;
+  infile.seekg(first - 1);
+  if (!getline(infile, line)) return false;
+  streamoff position = first - 1 + line.size() + 1;
+
+  while (position < last && getline(infile, line)) {
+    streamoff lineStart = position;
+    position += line.size() + 1;
+
+    // read the two integer nodes and the cost as a double
+    const char *text = line.c_str();
+    char *end;
+    WeightedEdge edge;
+    edge.node1 = strtol(text, &end, 10);
+    if (end == text) continue; // blank line
+    text = end;
+    edge.node2 = strtol(text, &end, 10);
+    if (end == text) continue;
+    text = end;
+    edge.value = strtod(text, &end);
+    if (end == text) continue;
+
+    if (edge.node1 < 0 || edge.node1 >= numNodes || edge.node2 < 0 || edge.node2 >= numNodes)
+      return false;
+    visit(edge, lineStart);
+  }
+
+  // stopping short of the range is only expected at the end of the file
+  return !infile.bad() && (position >= last || infile.eof());
+}
+
+uint64_t PipelinedMST::PairKey(const WeightedEdge &edge)
+{
+  return (uint64_t(uint32_t(min(edge.node1, edge.node2))) << 32) | uint32_t(max(edge.node1, edge.node2));
+}
@@ -0,0 +1,114 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// PipelinedMST.hpp
+
+#ifndef _HW3_PIPELINED_MST_H_
+#define _HW3_PIPELINED_MST_H_
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+#include "UndirectedGraph.hpp"
+#include "BoundedQueue.hpp"
+
+using namespace std;
+
+// Computes the minimum spanning forest of an edge list file while it is still being read.
+// Producer threads each parse a byte range of the file and pass chunks of edges through a
+// bounded queue to the calling thread, which merges them into the forest with Kruskal's
+// algorithm, so that the forest is almost complete when the last chunk arrives. The file
+// must hold one "node1 node2 cost" triple per line after the number of nodes.
+//
+// As in UndirectedGraph, a repeated edge keeps the distance of its last line and a distance
+// of 0.0 is no edge. A merged line cannot be taken back once a later line replaces it, so
+// the producers first scan the file for node pairs that may repeat, marking each pair in a
+// filter of one bit per byte of the file; the lines of those pairs are held back from the
+// chunks and resolved by their position in the file after the last one.
+class PipelinedMST
+{
+public:
+  // Constructor.
+  // @param numProducers The number of threads reading the file.
+  // @param chunkSize The number of edges passed through the queue at once.
+  // @param queueCapacity The maximum number of chunks waiting in the queue.
+  PipelinedMST(int numProducers = 2, size_t chunkSize = 65536, size_t queueCapacity = 8);
+
+  // Reads the file and computes its minimum spanning forest.
+  // @param filename The string representing the name of the file to open.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @return True on success, false if any part of the file could not be read or names a node
+  //         outside the graph.
+  bool run(const char* filename, vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Gets the time from the start of the last run until the whole file was read.
+  // @return The time, in seconds.
+  double getLoadSeconds();
+
+  // Gets the time the consumer spent merging chunks into the forest in the last run.
+  // @return The time, in seconds.
+  double getComputeSeconds();
+
+  // Gets the duration of the last run.
+  // @return The time, in seconds.
+  double getTotalSeconds();
+
+  // Gets the number of chunks passed through the queue in the last run.
+  // @return The number of chunks.
+  size_t getNumChunks();
+
+private:
+  // Parses the lines that start within the given byte range of the file.
+  // @param numNodes The number of nodes the edges may refer to.
+  // @param visit Called as visit(edge, position) for each edge, with the offset of its line.
+  // @return True on success, false if the file could not be opened or read to the end of the
+  //         range, or an edge refers to a node outside the graph.
+  template <typename Visitor>
+  bool readRange(const char* filename, int numNodes, streamoff first, streamoff last, Visitor visit);
+
+  // Gets the key of the node pair of an edge, the same in either direction.
+  // @param edge The edge.
+  // @return The lower node in the high 32 bits and the higher node in the low 32 bits.
+  static uint64_t PairKey(const WeightedEdge &edge);
+
+  // The number of threads reading the file.
+  int numProducers;
+
+  // The number of edges passed through the queue at once.
+  size_t chunkSize;
+
+  // The maximum number of chunks waiting in the queue.
+  size_t queueCapacity;
+
+  // The statistics of the last run.
+  double loadSeconds;
+  double computeSeconds;
+  double totalSeconds;
+  size_t numChunks;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline double PipelinedMST::getLoadSeconds()
+{
+  return loadSeconds;
+}
+
+inline double PipelinedMST::getComputeSeconds()
+{
+  return computeSeconds;
+}
+
+inline double PipelinedMST::getTotalSeconds()
+{
+  return totalSeconds;
+}
+
+inline size_t PipelinedMST::getNumChunks()
+{
+  return numChunks;
+}
+
+#endif // _HW3_PIPELINED_MST_H_
@@ -10,16 +10,59 @@
 
 using namespace std;
 
-template <typename T1, typename T2>
+// Heap ordering policies for PriorityQueue; each compares two (element, value) pairs and
+// returns true if the left one has lower priority.
+
+// Higher or lower values have higher priority, as chosen at run time.
+class SelectableOrder
+{
+public:
+  // @param preferHighValues True if you want high values to have higher priority, otherwise
+  //                         low values will have higher priority.
+  SelectableOrder(bool preferHighValues = true) : preferHighValues(preferHighValues) {}
+
+  template <typename T>
+  inline bool operator()(const T &lhs, const T &rhs) const
+  {
+    return preferHighValues ? lhs.second < rhs.second : lhs.second > rhs.second;
+  }
+
+private:
+  bool preferHighValues;
+};
+
+// Lower values have higher priority, fixed at compile time.
+class LowValuesFirst
+{
+public:
+  template <typename T>
+  inline bool operator()(const T &lhs, const T &rhs) const { return lhs.second > rhs.second; }
+};
+
+// Higher values have higher priority, fixed at compile time.
+class HighValuesFirst
+{
+public:
+  template <typename T>
+  inline bool operator()(const T &lhs, const T &rhs) const { return lhs.second < rhs.second; }
+};
+
+template <typename T1, typename T2, typename Order = SelectableOrder>
 class PriorityQueue
 {
 public:
+  // Constructor; creates a priority queue with elements type T1 and values type T2, ordered by
+  // the Order policy (for SelectableOrder, high values have higher priority).
+  PriorityQueue();
+
   // Constructor; creates a priority queue with elements type T1 and values type T2.
+  // Only available with SelectableOrder.
   // @param preferHighValues True if you want high values to have higher priority, otherwise
   //                         low values will have higher priority.
-  PriorityQueue(bool preferHighValues = true);
+  explicit PriorityQueue(bool preferHighValues);
 
   // Sets the comparator function such that the ordering is ascending or descending.
+  // Only available with SelectableOrder.
   // @param preferHighValues True if you want high values to have higher priority, otherwise
   //                         low values will have higher priority.
   void setComparator(bool preferHighValues);
@@ -68,16 +111,8 @@ private:
   vector<pair<T1, T2>> elements;
 
   // The comparison function used to determine the order of the elements in
-  // the priority queue. Can choose between:
-  //   a. Higher values have higher priority
-  //   b. Lower values have higher priority
-  function<bool(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)> comparison;
-
-  // Comparison function where the smaller values have higher priority.
-  static bool CompareAscending(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs);
-
-  // Comparison function where larger values have higher priority.
-  static bool CompareDescending(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs);
+  // the priority queue; a policy object, so the heap operations can inline it.
+  Order comparison;
 
   // Function object that is used to find the first matching element (compares the first item of the pair).
   class FindFirst
@@ -93,26 +128,31 @@ private:
 
 // Method definitions placed here to avoid clutter.
 
-template <typename T1, typename T2>
-PriorityQueue<T1, T2>::PriorityQueue(bool preferHighValues /*=true*/)
+template <typename T1, typename T2, typename Order>
+PriorityQueue<T1, T2, Order>::PriorityQueue()
+{
+}
+
+template <typename T1, typename T2, typename Order>
+PriorityQueue<T1, T2, Order>::PriorityQueue(bool preferHighValues) : comparison(preferHighValues)
 {
-  setComparator(preferHighValues);
 }
 
-template <typename T1, typename T2>
-void PriorityQueue<T1, T2>::setComparator(bool preferHighValues)
+template <typename T1, typename T2, typename Order>
+void PriorityQueue<T1, T2, Order>::setComparator(bool preferHighValues)
 {
-  comparison = preferHighValues ? CompareDescending : CompareAscending;
+  comparison = Order(preferHighValues);
+  make_heap(elements.begin(), elements.end(), comparison);
 }
 
-template <typename T1, typename T2>
-inline T1 PriorityQueue<T1, T2>::top()
+template <typename T1, typename T2, typename Order>
+inline T1 PriorityQueue<T1, T2, Order>::top()
 {
   return elements.front().first; // return the element at the top of the heap
 }
 
-template <typename T1, typename T2>
-T1 PriorityQueue<T1, T2>::pop()
+template <typename T1, typename T2, typename Order>
+T1 PriorityQueue<T1, T2, Order>::pop()
 {
   pop_heap(elements.begin(), elements.end(), comparison); // pop the top element from the heap range
 
@@ -123,40 +163,40 @@ T1 PriorityQueue<T1, T2>::pop()
   return topElement;
 }
 
-template <typename T1, typename T2>
-void PriorityQueue<T1, T2>::push(T1 element, T2 value)
+template <typename T1, typename T2, typename Order>
+void PriorityQueue<T1, T2, Order>::push(T1 element, T2 value)
 {
   // insert the element and place it in the correct position in the heap
   elements.push_back(pair<T1, T2>(element, value));
   push_heap(elements.begin(), elements.end(), comparison);
 }
 
-template <typename T1, typename T2>
-inline int PriorityQueue<T1, T2>::size()
+template <typename T1, typename T2, typename Order>
+inline int PriorityQueue<T1, T2, Order>::size()
 {
   return elements.size();
 }
 
-template <typename T1, typename T2>
-inline bool PriorityQueue<T1, T2>::empty()
+template <typename T1, typename T2, typename Order>
+inline bool PriorityQueue<T1, T2, Order>::empty()
 {
   return elements.empty();
 }
 
-template <typename T1, typename T2>
-inline void PriorityQueue<T1, T2>::clear()
+template <typename T1, typename T2, typename Order>
+inline void PriorityQueue<T1, T2, Order>::clear()
 {
   elements.clear();
 }
 
-template <typename T1, typename T2>
-inline bool PriorityQueue<T1, T2>::contains(T1 element)
+template <typename T1, typename T2, typename Order>
+inline bool PriorityQueue<T1, T2, Order>::contains(T1 element)
 {
   return find_if(elements.begin(), elements.end(), FindFirst(element)) != elements.end();
 }
 
-template <typename T1, typename T2>
-void PriorityQueue<T1, T2>::changePriority(T1 element, T2 value)
+template <typename T1, typename T2, typename Order>
+void PriorityQueue<T1, T2, Order>::changePriority(T1 element, T2 value)
 {
   typename vector<std::pair<T1, T2> >::iterator it = find_if(elements.begin(), elements.end(), FindFirst(element));
   if (it != elements.end()) {
@@ -165,20 +205,8 @@ void PriorityQueue<T1, T2>::changePriority(T1 element, T2 value)
   }
 }
 
-template <typename T1, typename T2>
-bool PriorityQueue<T1, T2>::CompareAscending(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
-{
-  return lhs.second > rhs.second;
-}
-
-template <typename T1, typename T2>
-bool PriorityQueue<T1, T2>::CompareDescending(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs)
-{
-  return lhs.second < rhs.second;
-}
-
-template <typename T1, typename T2>
-inline T2 PriorityQueue<T1, T2>::getTopPriority()
+template <typename T1, typename T2, typename Order>
+inline T2 PriorityQueue<T1, T2, Order>::getTopPriority()
 {
   return elements.front().second; // return the element's priority at the top of the heap
 }
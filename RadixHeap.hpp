@@ -0,0 +1,250 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// RadixHeap.hpp
+
+#ifndef _HW3_RADIX_HEAP_H_
+#define _HW3_RADIX_HEAP_H_
+
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+using namespace std;
+
+// A monotone priority queue where low values have higher priority. Each value is mapped
+// to an unsigned 64-bit key, and elements are kept in buckets by the highest bit in which
+// their key differs from the last removed key; removing an element only redistributes one
+// bucket, for O(log C) amortized work per element. The value of a new element must be no
+// lower than the value of the last removed element (as in Kruskal's algorithm, where all
+// the edges are inserted before any is removed). T2 must be an arithmetic type.
+template <typename T1, typename T2>
+class RadixHeap
+{
+public:
+  // Constructor; creates an empty radix heap.
+  RadixHeap();
+
+  // Access the top element in this priority queue.
+  // @return Returns the element with the lowest value without removing it from the queue.
+  T1 top();
+
+  // Remove the top element in this priority queue.
+  // @return Removes and returns the element with the lowest value from the queue.
+  T1 pop();
+
+  // Insert an element into this priority queue.
+  // @param element The element to insert into the queue.
+  // @param value The value of the element, no lower than the last removed value.
+  void push(T1 element, T2 value);
+
+  // Gets the size of this priority queue.
+  // @return The number of elements in the queue.
+  int size();
+
+  // Tests if the priority queue is empty.
+  // @return True if the priority queue is empty, otherwise false.
+  bool empty();
+
+  // Clears the contents of the priority queue.
+  void clear();
+
+  // Checks for the first occurrence of a specific element in the the queue.
+  // @param element The element whose existence in the queue is to be determined.
+  // @return True if the element exists, false otherwise.
+  bool contains(T1 element);
+
+  // Changes the value of the first occurrence of a specific element.
+  // @param element The element whose value we wish to change.
+  // @param value The new value of the element, no lower than the last removed value.
+  void changePriority(T1 element, T2 value);
+
+  // Access the top element's priority in this priority queue.
+  // @return Returns the current lowest value in the queue.
+  T2 getTopPriority();
+
+private:
+  // An element, its value, and the key derived from the value.
+  struct Entry
+  {
+    T1 element;
+    T2 value;
+    uint64_t key;
+  };
+
+  // Maps a value to a key such that lower values get lower keys.
+  static uint64_t toKey(T2 value);
+  static uint64_t toKey(T2 value, true_type isFloatingPoint);
+  static uint64_t toKey(T2 value, false_type isFloatingPoint);
+
+  // Gets the bucket of a key: 0 if it equals the last removed key, otherwise one more than
+  // the index of the highest bit in which they differ.
+  int bucketOf(uint64_t key);
+
+  // Makes sure that the lowest element is in bucket 0.
+  void refill();
+
+  // The buckets; all the entries of bucket 0 have the last removed key.
+  array<vector<Entry>, 65> buckets;
+
+  // The last removed key.
+  uint64_t lastKey;
+
+  // The number of elements in the queue.
+  int numElements;
+
+};
+
+// Method definitions placed here to avoid clutter.
+
+template <typename T1, typename T2>
+RadixHeap<T1, T2>::RadixHeap()
+{
+  lastKey = 0;
+  numElements = 0;
+}
+
+template <typename T1, typename T2>
+inline T1 RadixHeap<T1, T2>::top()
+{
+  refill();
+  return buckets[0].back().element;
+}
+
+template <typename T1, typename T2>
+T1 RadixHeap<T1, T2>::pop()
+{
+  refill();
+  T1 topElement = buckets[0].back().element;
+  buckets[0].pop_back();
+  numElements--;
+  return topElement;
+}
+
+template <typename T1, typename T2>
+inline void RadixHeap<T1, T2>::push(T1 element, T2 value)
+{
+  uint64_t key = toKey(value);
+  buckets[bucketOf(key)].push_back(Entry{ element, value, key });
+  numElements++;
+}
+
+template <typename T1, typename T2>
+inline int RadixHeap<T1, T2>::size()
+{
+  return numElements;
+}
+
+template <typename T1, typename T2>
+inline bool RadixHeap<T1, T2>::empty()
+{
+  return numElements == 0;
+}
+
+template <typename T1, typename T2>
+void RadixHeap<T1, T2>::clear()
+{
+  for (auto it = buckets.begin(); it != buckets.end(); ++it)
+    it->clear();
+  lastKey = 0;
+  numElements = 0;
+}
+
+template <typename T1, typename T2>
+bool RadixHeap<T1, T2>::contains(T1 element)
+{
+  for (auto bucket = buckets.begin(); bucket != buckets.end(); ++bucket) {
+    for (auto it = bucket->begin(); it != bucket->end(); ++it) {
+      if (it->element == element) return true;
+    }
+  }
+  return false;
+}
+
+template <typename T1, typename T2>
+void RadixHeap<T1, T2>::changePriority(T1 element, T2 value)
+{
+  for (auto bucket = buckets.begin(); bucket != buckets.end(); ++bucket) {
+    for (auto it = bucket->begin(); it != bucket->end(); ++it) {
+      if (it->element == element) {
+        bucket->erase(it);
+        numElements--;
+        push(element, value);
+        return;
+      }
+    }
+  }
+}
+
+template <typename T1, typename T2>
+inline T2 RadixHeap<T1, T2>::getTopPriority()
+{
+  refill();
+  return buckets[0].back().value;
+}
+
+template <typename T1, typename T2>
+inline uint64_t RadixHeap<T1, T2>::toKey(T2 value)
+{
+  return toKey(value, typename is_floating_point<T2>::type());
+}
+
+template <typename T1, typename T2>
+inline uint64_t RadixHeap<T1, T2>::toKey(T2 value, true_type /*isFloatingPoint*/)
+{
+  // the bits of a non-negative double order like the double itself; negative
+  // doubles order in reverse, so flip them, and put them below the positive ones
+  double asDouble = value;
+  uint64_t bits;
+  memcpy(&bits, &asDouble, sizeof(bits));
+  return (bits >> 63) ? ~bits : bits | (uint64_t(1) << 63);
+}
+
+template <typename T1, typename T2>
+inline uint64_t RadixHeap<T1, T2>::toKey(T2 value, false_type /*isFloatingPoint*/)
+{
+  // offset signed values so that negative ones come first
+  uint64_t bits = uint64_t(value);
+  return is_signed<T2>::value ? bits ^ (uint64_t(1) << 63) : bits;
+}
+
+template <typename T1, typename T2>
+inline int RadixHeap<T1, T2>::bucketOf(uint64_t key)
+{
+  uint64_t difference = key ^ lastKey;
+#if defined(__GNUC__)
+  return difference == 0 ? 0 : 64 - __builtin_clzll(difference);
+#else
+  int bucket = 0;
+  while (difference != 0) {
+    difference >>= 1;
+    bucket++;
+  }
+  return bucket;
+#endif
+}
+
+template <typename T1, typename T2>
+void RadixHeap<T1, T2>::refill()
+{
+  if (!buckets[0].empty()) return;
+
+  // the first non-empty bucket holds the lowest key; every other entry of that bucket
+  // differs from it in a lower bit than it differed from the old last key
+  int index = 1;
+  while (buckets[index].empty())
+    index++;
+
+  vector<Entry> &bucket = buckets[index];
+  lastKey = min_element(bucket.begin(), bucket.end(), [](const Entry &lhs, const Entry &rhs) {
+    return lhs.key < rhs.key;
+  })->key;
+
+  for (auto it = bucket.begin(); it != bucket.end(); ++it)
+    buckets[bucketOf(it->key)].push_back(*it);
+  bucket.clear();
+}
+
+#endif // _HW3_RADIX_HEAP_H_
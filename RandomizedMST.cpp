@@ -0,0 +1,426 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// RandomizedMST.cpp
+
+#include <algorithm>
+#include <numeric>
+
+#include "RandomizedMST.hpp"
+
+RandomizedMST::RandomizedMST(uint64_t seed /*=DefaultSeed*/) : generator(seed)
+{
+  numBoruvkaSteps = 0;
+  numRecursiveCalls = 0;
+  numDiscardedEdges = 0;
+}
+
+void RandomizedMST::run(int numNodes, const vector<WeightedEdge> &edgeList, vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  edges.clear();
+  cost.clear();
+  numBoruvkaSteps = 0;
+  numRecursiveCalls = 0;
+  numDiscardedEdges = 0;
+
+  // each edge is tagged with its position in the list, which the forest is returned as
+  vector<Edge> levelEdges(edgeList.size());
+  for (size_t i = 0; i < edgeList.size(); ++i)
+    levelEdges[i] = Edge{ edgeList[i].value, edgeList[i].node1, edgeList[i].node2, int64_t(i), int64_t(i) };
+
+  vector<int64_t> forest;
+  solve(numNodes, levelEdges, forest);
+
+  sort(forest.begin(), forest.end(), [&edgeList](int64_t lhs, int64_t rhs) {
+    return edgeList[lhs].value < edgeList[rhs].value || (edgeList[lhs].value == edgeList[rhs].value && lhs < rhs);
+  });
+  for (auto it = forest.begin(); it != forest.end(); ++it) {
+    edges.push_back(pair<int, int>(edgeList[*it].node1, edgeList[*it].node2));
+    cost.push_back(edgeList[*it].value);
+  }
+}
+
+void RandomizedMST::solve(int numNodes, vector<Edge> &edges, vector<int64_t> &forest)
+{
+  numRecursiveCalls++;
+
+  if (edges.size() <= BaseCaseEdges) {
+    runKruskal(numNodes, edges, forest);
+    return;
+  }
+
+  // each step at least halves the number of nodes that still have edges
+  for (int step = 0; step < 2 && !edges.empty(); ++step)
+    runBoruvkaStep(numNodes, edges, forest);
+  if (edges.empty()) return;
+
+  // the forest of a random half of the edges; each sampled edge is tagged with its
+  // position here, so the forest edges can be found again in this level's labels
+  vector<Edge> sample;
+  sample.reserve(edges.size() / 2 + edges.size() / 16);
+  uint64_t randomBits = 0;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (i % 64 == 0)
+      randomBits = generator();
+    if ((randomBits >> (i % 64)) & 1) {
+      sample.push_back(edges[i]);
+      sample.back().tag = int64_t(i);
+    }
+  }
+
+  vector<int64_t> sampleForest;
+  solve(numNodes, sample, sampleForest);
+  vector<Edge>().swap(sample);
+
+  vector<Edge> forestEdges;
+  forestEdges.reserve(sampleForest.size());
+  for (auto it = sampleForest.begin(); it != sampleForest.end(); ++it)
+    forestEdges.push_back(edges[*it]);
+
+  // an edge heavier than the whole forest path between its nodes is in no minimum
+  // spanning forest; the expected number of edges left is at most twice the nodes
+  size_t numEdges = edges.size();
+  removeHeavyEdges(numNodes, forestEdges, edges);
+  numDiscardedEdges += numEdges - edges.size();
+
+  solve(numNodes, edges, forest);
+}
+
+void RandomizedMST::runKruskal(int numNodes, vector<Edge> &edges, vector<int64_t> &forest)
+{
+  sort(edges.begin(), edges.end(), lighter);
+
+  vector<int> parent(numNodes);
+  iota(parent.begin(), parent.end(), 0);
+  for (auto it = edges.begin(); it != edges.end(); ++it) {
+    int root1 = findRoot(parent, it->node1);
+    int root2 = findRoot(parent, it->node2);
+    if (root1 != root2) {
+      parent[root1] = root2; // connect the two sets
+      forest.push_back(it->tag);
+    }
+  }
+}
+
+void RandomizedMST::runBoruvkaStep(int &numNodes, vector<Edge> &edges, vector<int64_t> &forest)
+{
+  // the lightest edge of each node
+  vector<int64_t> lightest(numNodes, -1);
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const Edge &edge = edges[i];
+    if (edge.node1 == edge.node2) continue;
+    if (lightest[edge.node1] < 0 || lighter(edge, edges[lightest[edge.node1]]))
+      lightest[edge.node1] = int64_t(i);
+    if (lightest[edge.node2] < 0 || lighter(edge, edges[lightest[edge.node2]]))
+      lightest[edge.node2] = int64_t(i);
+  }
+
+  // with distinct edges these never close a cycle; an edge chosen from both ends is added once
+  vector<int> parent(numNodes);
+  iota(parent.begin(), parent.end(), 0);
+  for (int node = 0; node < numNodes; ++node) {
+    if (lightest[node] < 0) continue;
+    const Edge &edge = edges[lightest[node]];
+    int root1 = findRoot(parent, edge.node1);
+    int root2 = findRoot(parent, edge.node2);
+    if (root1 != root2) {
+      parent[root1] = root2;
+      forest.push_back(edge.tag);
+    }
+  }
+
+  // number the contracted nodes that still have edges, and drop the edges inside them
+  vector<int> label(numNodes, -1);
+  int numLabels = 0;
+  size_t numKept = 0;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    Edge edge = edges[i];
+    int root1 = findRoot(parent, edge.node1);
+    int root2 = findRoot(parent, edge.node2);
+    if (root1 == root2) continue;
+
+    if (label[root1] < 0) label[root1] = numLabels++;
+    if (label[root2] < 0) label[root2] = numLabels++;
+    edge.node1 = label[root1];
+    edge.node2 = label[root2];
+    edges[numKept++] = edge;
+  }
+  edges.resize(numKept);
+
+  numNodes = numLabels;
+  numBoruvkaSteps++;
+}
+
+void RandomizedMST::buildBoruvkaTree(int numNodes, const vector<Edge> &forestEdges, vector<int> &treeParent, vector<int> &treeEdge)
+{
+  // the forest's nodes are the leaves; each round adds one tree node per component it forms
+  treeParent.assign(numNodes, -1);
+  treeEdge.assign(numNodes, -1);
+
+  struct RoundEdge
+  {
+    int node1; // the first node, in the labels of this round
+    int node2; // the second node, in the labels of this round
+    int edge; // the forest edge
+  };
+  vector<int> roundNodes(numNodes); // the tree node of each node of this round
+  iota(roundNodes.begin(), roundNodes.end(), 0);
+  vector<RoundEdge> roundEdges(forestEdges.size());
+  for (size_t i = 0; i < forestEdges.size(); ++i)
+    roundEdges[i] = RoundEdge{ forestEdges[i].node1, forestEdges[i].node2, int(i) };
+
+  vector<int> lightest, neighbor, label, path;
+  while (!roundEdges.empty()) {
+    int numRoundNodes = int(roundNodes.size());
+    lightest.assign(numRoundNodes, -1);
+    neighbor.assign(numRoundNodes, -1);
+    for (auto it = roundEdges.begin(); it != roundEdges.end(); ++it) {
+      if (lightest[it->node1] < 0 || lighter(forestEdges[it->edge], forestEdges[lightest[it->node1]])) {
+        lightest[it->node1] = it->edge;
+        neighbor[it->node1] = it->node2;
+      }
+      if (lightest[it->node2] < 0 || lighter(forestEdges[it->edge], forestEdges[lightest[it->node2]])) {
+        lightest[it->node2] = it->edge;
+        neighbor[it->node2] = it->node1;
+      }
+    }
+
+    // Following the lightest edges from any node ends at the one edge of its component that was
+    // chosen from both ends, so the lower node of that edge names the component. A node without
+    // edges has a whole tree of the forest below it, and stays a root.
+    label.assign(numRoundNodes, -1);
+    int numLabels = 0;
+    for (int node = 0; node < numRoundNodes; ++node) {
+      if (lightest[node] < 0) continue;
+      path.clear();
+      int current = node;
+      while (label[current] < 0) {
+        int next = neighbor[current];
+        if (neighbor[next] == current && current < next) {
+          label[current] = numLabels++;
+          break;
+        }
+        path.push_back(current);
+        current = next;
+      }
+      for (auto it = path.begin(); it != path.end(); ++it)
+        label[*it] = label[current];
+    }
+
+    // the edge up from a node is the lightest edge it chose
+    int firstNew = int(treeParent.size());
+    treeParent.resize(firstNew + numLabels, -1);
+    treeEdge.resize(firstNew + numLabels, -1);
+    for (int node = 0; node < numRoundNodes; ++node) {
+      if (label[node] < 0) continue;
+      treeParent[roundNodes[node]] = firstNew + label[node];
+      treeEdge[roundNodes[node]] = lightest[node];
+    }
+    roundNodes.resize(numLabels);
+    iota(roundNodes.begin(), roundNodes.end(), firstNew);
+
+    // in a forest the chosen edges are the only ones inside a component
+    size_t numKept = 0;
+    for (auto it = roundEdges.begin(); it != roundEdges.end(); ++it) {
+      if (label[it->node1] != label[it->node2])
+        roundEdges[numKept++] = RoundEdge{ label[it->node1], label[it->node2], it->edge };
+    }
+    roundEdges.resize(numKept);
+  }
+}
+
+void RandomizedMST::removeHeavyEdges(int numNodes, const vector<Edge> &forestEdges, vector<Edge> &edges)
+{
+  vector<int> treeParent, treeEdge;
+  buildBoruvkaTree(numNodes, forestEdges, treeParent, treeEdge);
+  int numTreeNodes = int(treeParent.size());
+
+  // parents are numbered after their children, so a backward sweep reaches every parent first
+  vector<int> depth(numTreeNodes), treeRoot(numTreeNodes);
+  vector<int> childOffsets(numTreeNodes + 1, 0);
+  for (int node = numTreeNodes - 1; node >= 0; --node) {
+    int parent = treeParent[node];
+    depth[node] = (parent < 0) ? 0 : depth[parent] + 1;
+    treeRoot[node] = (parent < 0) ? node : treeRoot[parent];
+    if (parent >= 0) childOffsets[parent + 1]++;
+  }
+  partial_sum(childOffsets.begin(), childOffsets.end(), childOffsets.begin());
+  vector<int> children(childOffsets[numTreeNodes]);
+  {
+    vector<int> next(childOffsets.begin(), childOffsets.end() - 1);
+    for (int node = 0; node < numTreeNodes; ++node) {
+      if (treeParent[node] >= 0)
+        children[next[treeParent[node]]++] = node;
+    }
+  }
+
+  // the edges to check, listed at both of their nodes; loops and edges between two trees of
+  // the forest have no path to be heavier than
+  vector<int64_t> queryOffsets(numNodes + 1, 0);
+  for (auto it = edges.begin(); it != edges.end(); ++it) {
+    if (it->node1 == it->node2 || treeRoot[it->node1] != treeRoot[it->node2]) continue;
+    queryOffsets[it->node1 + 1]++;
+    queryOffsets[it->node2 + 1]++;
+  }
+  partial_sum(queryOffsets.begin(), queryOffsets.end(), queryOffsets.begin());
+  vector<int64_t> queries(queryOffsets[numNodes]);
+  {
+    vector<int64_t> next(queryOffsets.begin(), queryOffsets.end() - 1);
+    for (size_t i = 0; i < edges.size(); ++i) {
+      const Edge &edge = edges[i];
+      if (edge.node1 == edge.node2 || treeRoot[edge.node1] != treeRoot[edge.node2]) continue;
+      queries[next[edge.node1]++] = int64_t(i);
+      queries[next[edge.node2]++] = int64_t(i);
+    }
+  }
+
+  // The lowest common ancestor of each checked edge's nodes, found offline while visiting the
+  // tree: a finished node's set is merged into its parent's, and the set of a finished node
+  // knows the lowest of its ancestors that is still being visited.
+  vector<int> ancestor(edges.size(), -1);
+  {
+    vector<int> setParent(numTreeNodes), setSize(numTreeNodes, 1), setAncestor(numTreeNodes);
+    iota(setParent.begin(), setParent.end(), 0);
+    iota(setAncestor.begin(), setAncestor.end(), 0);
+    auto findSet = [&setParent](int node) {
+      while (setParent[node] != node) {
+        setParent[node] = setParent[setParent[node]];
+        node = setParent[node];
+      }
+      return node;
+    };
+
+    vector<char> finished(numTreeNodes, 0);
+    vector<pair<int, int>> stack; // (node, next child position)
+    for (int root = 0; root < numTreeNodes; ++root) {
+      if (treeParent[root] >= 0) continue;
+      stack.push_back(pair<int, int>(root, childOffsets[root]));
+      while (!stack.empty()) {
+        int node = stack.back().first;
+        if (stack.back().second < childOffsets[node + 1]) {
+          int child = children[stack.back().second++];
+          stack.push_back(pair<int, int>(child, childOffsets[child]));
+          continue;
+        }
+
+        // only the leaves are nodes of the forest; each edge is resolved at its second node
+        if (node < numNodes) {
+          for (int64_t i = queryOffsets[node]; i < queryOffsets[node + 1]; ++i) {
+            const Edge &edge = edges[queries[i]];
+            int other = (edge.node1 == node) ? edge.node2 : edge.node1;
+            if (finished[other])
+              ancestor[queries[i]] = setAncestor[findSet(other)];
+          }
+        }
+        finished[node] = 1;
+        stack.pop_back();
+
+        int parent = treeParent[node];
+        if (parent >= 0) {
+          int set1 = findSet(node), set2 = findSet(parent);
+          if (setSize[set1] > setSize[set2]) swap(set1, set2);
+          setParent[set1] = set2;
+          setSize[set2] += setSize[set1];
+          setAncestor[set2] = parent;
+        }
+      }
+    }
+  }
+
+  // The depths of the ancestors that the checked paths below each node climb to. The tree of
+  // Boruvka rounds is at most 32 levels deep, so a word holds them.
+  vector<uint64_t> upDepths(numTreeNodes, 0);
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (ancestor[i] < 0) continue;
+    uint64_t bit = uint64_t(1) << depth[ancestor[i]];
+    upDepths[edges[i].node1] |= bit;
+    upDepths[edges[i].node2] |= bit;
+  }
+  for (int node = 0; node < numTreeNodes; ++node) {
+    int parent = treeParent[node];
+    if (parent >= 0)
+      upDepths[parent] |= upDepths[node] & ((uint64_t(1) << depth[parent]) - 1);
+  }
+
+  // Going down the tree, each node keeps the heaviest edge between itself and every ancestor
+  // depth it needs. Those edges get lighter as the ancestor gets closer, so each is named by
+  // the depth of its lower end, and the edge for an ancestor depth is the first one named below
+  // it: the whole list is one word. A node takes its parent's list, keeps the entries for its
+  // own ancestor depths, and replaces the entries lighter than the edge up to its parent, which
+  // are the deepest ones and found by a binary search.
+  vector<uint64_t> heaviest(numTreeNodes, 0);
+  vector<int> pathMax(edges.size(), -1);
+  {
+    auto heavier = [&forestEdges](int lhs, int rhs) {
+      if (lhs < 0) return rhs;
+      if (rhs < 0) return lhs;
+      return lighter(forestEdges[lhs], forestEdges[rhs]) ? rhs : lhs;
+    };
+
+    int pathEdges[64]; // the edge up from the node at each depth of the current path
+    vector<pair<int, int>> stack; // (node, next child position)
+    for (int root = 0; root < numTreeNodes; ++root) {
+      if (treeParent[root] >= 0) continue;
+      stack.push_back(pair<int, int>(root, childOffsets[root]));
+      while (!stack.empty()) {
+        int node = stack.back().first;
+        if (stack.back().second >= childOffsets[node + 1]) {
+          stack.pop_back();
+          continue;
+        }
+        node = children[stack.back().second++];
+        stack.push_back(pair<int, int>(node, childOffsets[node]));
+
+        int parentDepth = depth[node] - 1;
+        const Edge &up = forestEdges[treeEdge[node]];
+        pathEdges[depth[node]] = treeEdge[node];
+
+        // the first parent entry above each of this node's ancestor depths; adding a bit into a
+        // run of positions the parent names nothing at carries into the entry that ends the run
+        uint64_t parentList = heaviest[treeParent[node]];
+        uint64_t starts = (upDepths[node] & ((uint64_t(1) << parentDepth) - 1)) << 1;
+        uint64_t list = (((~parentList) + (starts & ~parentList)) & parentList) | (starts & parentList);
+
+        // the lowest position from which on every entry is lighter than the edge up
+        int low = 0, high = parentDepth + 1;
+        while (low < high) {
+          int middle = (low + high) / 2;
+          uint64_t above = list >> middle;
+          int position = (above == 0) ? high : middle + __builtin_ctzll(above);
+          if (position >= high || lighter(forestEdges[pathEdges[position]], up))
+            high = middle;
+          else
+            low = position + 1;
+        }
+        bool replaced = (list >> low) != 0;
+        list &= (uint64_t(1) << low) - 1;
+        if (replaced || ((upDepths[node] >> parentDepth) & 1))
+          list |= uint64_t(1) << depth[node];
+        heaviest[node] = list;
+
+        if (node < numNodes) {
+          for (int64_t i = queryOffsets[node]; i < queryOffsets[node + 1]; ++i) {
+            int start = depth[ancestor[queries[i]]] + 1;
+            int position = start + __builtin_ctzll(list >> start);
+            pathMax[queries[i]] = heavier(pathMax[queries[i]], pathEdges[position]);
+          }
+        }
+      }
+    }
+  }
+
+  size_t numKept = 0;
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (pathMax[i] < 0 || !lighter(forestEdges[pathMax[i]], edges[i]))
+      edges[numKept++] = edges[i];
+  }
+  edges.resize(numKept);
+}
+
+int RandomizedMST::findRoot(vector<int> &parent, int node)
+{
+  // halve the path on the way up
+  while (parent[node] != node) {
+    parent[node] = parent[parent[node]];
+    node = parent[node];
+  }
+  return node;
+}
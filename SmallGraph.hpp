@@ -0,0 +1,280 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// SmallGraph.hpp
+
+#ifndef _HW3_SMALL_GRAPH_H_
+#define _HW3_SMALL_GRAPH_H_
+
+#include <array>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstdint>
+#include <cassert>
+
+using namespace std;
+
+// The spanning forest of a SmallGraph, held without any heap allocation.
+template <int N>
+struct SmallSpanningTree
+{
+  int numEdges; // the number of edges in the forest
+  double totalCost; // the sum of the edge costs
+  array<pair<int, int>, N> edges; // the edges (as pairs of node indices), in the order they were added
+  array<double, N> cost; // the cost of each edge
+};
+
+// An undirected graph of at most N (up to 64) nodes, kept entirely in fixed-size arrays:
+// the edge values in an N x N array, and the neighbors of each node as a bit mask.
+// Meant for computing very many spanning trees of tiny graphs with no heap allocation.
+template <int N>
+class SmallGraph
+{
+  static_assert(N >= 1 && N <= 64, "SmallGraph supports 1 to 64 nodes");
+
+public:
+  // Constructor; creates a graph with no edges.
+  // @param numNodes The number of nodes in this graph, at most N.
+  SmallGraph(int numNodes = N);
+
+  // Returns the number of nodes in this graph.
+  // @return The number of nodes in this graph.
+  int getNumNodes() const;
+
+  // Returns the number of edges in this graph.
+  // @return The number of edges in this graph.
+  int getNumEdges() const;
+
+  // Test if there is an edge between two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return True if an edge exists, otherwise false.
+  bool isAdjacent(int node1, int node2) const;
+
+  // Calls the visitor for every node connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachNeighbor(int node, Visitor visit) const;
+
+  // Calls the visitor for every node with a higher index connected to the given node, in increasing order.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachHigherNeighbor(int node, Visitor visit) const;
+
+  // Adds an edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @param dist The edge distance.
+  void addEdge(int node1, int node2, double dist);
+
+  // Delete the edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  void deleteEdge(int node1, int node2);
+
+  // Returns the value associated with the edge between the two nodes.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @return The edge value, or 0.0 if there is no edge.
+  double getEdgeValue(int node1, int node2) const;
+
+  // Sets the edge value between the two nodes, adding the edge if needed; as in UndirectedGraph,
+  // a value of 0.0 is no edge, so it deletes the edge instead.
+  // @param node1 The first node.
+  // @param node2 The second node.
+  // @param value The edge value to set.
+  void setEdgeValue(int node1, int node2, double value);
+
+  // Run Prim's Algorithm on the dense edge array to find the Minimum Spanning Tree of this graph;
+  // a graph with several components gets a tree for each, started from its lowest node.
+  // @param tree The spanning forest returned.
+  void runPrimAlgorithm(SmallSpanningTree<N> &tree) const;
+
+  // Run Prim's Algorithm, returning the result in the format used by the other graphs.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  void runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost) const;
+
+private:
+  // Returns the index of the lowest set bit of a non-zero mask.
+  static int lowestBit(uint64_t mask);
+
+  // The number of nodes in this graph.
+  int numNodes;
+
+  // The number of edges in this graph.
+  int numEdges;
+
+  // Bit j of neighborMasks[i] is set if nodes i and j are connected.
+  array<uint64_t, N> neighborMasks;
+
+  // The edge values; the value between nodes i and j is at index i * N + j.
+  array<double, N * N> edgeValues;
+
+};
+
+// Method definitions placed here to avoid clutter.
+
+template <int N>
+SmallGraph<N>::SmallGraph(int numNodes /*=N*/)
+{
+  assert(numNodes >= 0 && numNodes <= N); // the masks and arrays hold N nodes
+  this->numNodes = numNodes;
+  this->numEdges = 0;
+  neighborMasks.fill(0);
+  edgeValues.fill(0.0);
+}
+
+template <int N>
+inline int SmallGraph<N>::getNumNodes() const
+{
+  return numNodes;
+}
+
+template <int N>
+inline int SmallGraph<N>::getNumEdges() const
+{
+  return numEdges;
+}
+
+template <int N>
+inline bool SmallGraph<N>::isAdjacent(int node1, int node2) const
+{
+  return (neighborMasks[node1] >> node2) & 1;
+}
+
+template <int N>
+template <typename Visitor>
+inline void SmallGraph<N>::forEachNeighbor(int node, Visitor visit) const
+{
+  for (uint64_t mask = neighborMasks[node]; mask != 0; mask &= mask - 1) {
+    int neighbor = lowestBit(mask);
+    visit(neighbor, edgeValues[node * N + neighbor]);
+  }
+}
+
+template <int N>
+template <typename Visitor>
+inline void SmallGraph<N>::forEachHigherNeighbor(int node, Visitor visit) const
+{
+  uint64_t higher = (node == 63) ? 0 : ~uint64_t(0) << (node + 1);
+  for (uint64_t mask = neighborMasks[node] & higher; mask != 0; mask &= mask - 1) {
+    int neighbor = lowestBit(mask);
+    visit(neighbor, edgeValues[node * N + neighbor]);
+  }
+}
+
+template <int N>
+inline void SmallGraph<N>::addEdge(int node1, int node2, double dist)
+{
+  setEdgeValue(node1, node2, dist);
+}
+
+template <int N>
+inline void SmallGraph<N>::deleteEdge(int node1, int node2)
+{
+  if (!isAdjacent(node1, node2)) return;
+
+  neighborMasks[node1] &= ~(uint64_t(1) << node2);
+  neighborMasks[node2] &= ~(uint64_t(1) << node1);
+  edgeValues[node1 * N + node2] = 0.0;
+  edgeValues[node2 * N + node1] = 0.0;
+
+  numEdges--; // update the number of edges
+}
+
+template <int N>
+inline double SmallGraph<N>::getEdgeValue(int node1, int node2) const
+{
+  return edgeValues[node1 * N + node2];
+}
+
+template <int N>
+inline void SmallGraph<N>::setEdgeValue(int node1, int node2, double value)
+{
+  if (value == 0.0) {
+    deleteEdge(node1, node2);
+    return;
+  }
+
+  // increment the number of edges if the nodes are not already connected
+  if (!isAdjacent(node1, node2))
+    numEdges++;
+
+  neighborMasks[node1] |= uint64_t(1) << node2;
+  neighborMasks[node2] |= uint64_t(1) << node1;
+  edgeValues[node1 * N + node2] = value;
+  edgeValues[node2 * N + node1] = value;
+}
+
+template <int N>
+void SmallGraph<N>::runPrimAlgorithm(SmallSpanningTree<N> &tree) const
+{
+  // the cheapest known edge from the tree to each node, and the tree node it comes from
+  array<double, N> bestValue;
+  array<int, N> bestParent;
+  bestValue.fill(numeric_limits<double>::infinity());
+  bestParent.fill(-1);
+
+  tree.numEdges = 0;
+  tree.totalCost = 0.0;
+
+  uint64_t unvisited = (numNodes == 64) ? ~uint64_t(0) : (uint64_t(1) << numNodes) - 1;
+  while (unvisited != 0) {
+    // pick the unvisited node with the cheapest connection; a node that cannot be
+    // reached at all (the lowest one, on ties) starts a new tree
+    int node = lowestBit(unvisited);
+    for (uint64_t mask = unvisited & (unvisited - 1); mask != 0; mask &= mask - 1) {
+      int candidate = lowestBit(mask);
+      if (bestValue[candidate] < bestValue[node])
+        node = candidate;
+    }
+    unvisited &= ~(uint64_t(1) << node);
+
+    // record the edge and its cost
+    if (bestParent[node] >= 0) {
+      tree.edges[tree.numEdges] = pair<int, int>(bestParent[node], node);
+      tree.cost[tree.numEdges] = bestValue[node];
+      tree.totalCost += bestValue[node];
+      tree.numEdges++;
+    }
+
+    // relax the edges to the unvisited neighbors
+    const double *row = &edgeValues[node * N];
+    for (uint64_t mask = neighborMasks[node] & unvisited; mask != 0; mask &= mask - 1) {
+      int neighbor = lowestBit(mask);
+      if (row[neighbor] < bestValue[neighbor]) {
+        bestValue[neighbor] = row[neighbor];
+        bestParent[neighbor] = node;
+      }
+    }
+  }
+}
+
+template <int N>
+void SmallGraph<N>::runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost) const
+{
+  SmallSpanningTree<N> tree;
+  runPrimAlgorithm(tree);
+
+  edges.assign(tree.edges.begin(), tree.edges.begin() + tree.numEdges);
+  cost.assign(tree.cost.begin(), tree.cost.begin() + tree.numEdges);
+}
+
+template <int N>
+inline int SmallGraph<N>::lowestBit(uint64_t mask)
+{
+#if defined(__GNUC__)
+  return __builtin_ctzll(mask);
+#else
+  int index = 0;
+  while ((mask & 1) == 0) {
+    mask >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+#endif // _HW3_SMALL_GRAPH_H_
@@ -0,0 +1,50 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// SpanningForest.cpp
+
+#include <algorithm>
+
+#include "SpanningForest.hpp"
+#include "DisjointSet.hpp"
+
+SpanningForest::SpanningForest(int numNodes)
+{
+  this->numNodes = numNodes;
+}
+
+void SpanningForest::merge(const vector<WeightedEdge> &batch)
+{
+  // only the current forest edges can survive from earlier batches; the forest is
+  // already sorted, so only the batch needs sorting before the two are combined
+  vector<WeightedEdge> sortedBatch(batch);
+  sort(sortedBatch.begin(), sortedBatch.end(), CompareEdges);
+
+  vector<WeightedEdge> candidates(forestEdges.size() + sortedBatch.size());
+  std::merge(forestEdges.begin(), forestEdges.end(), sortedBatch.begin(), sortedBatch.end(),
+             candidates.begin(), CompareEdges);
+
+  DisjointSet ds(numNodes);
+  forestEdges.clear();
+  for (auto it = candidates.begin(); it != candidates.end(); ++it) {
+    if (!ds.isConnected(it->node1, it->node2)) {
+      forestEdges.push_back(*it);
+      ds.merge(it->node1, it->node2); // connect the two sets
+    }
+  }
+}
+
+void SpanningForest::getSpanningTree(vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  edges.clear();
+  cost.clear();
+  for (auto it = forestEdges.begin(); it != forestEdges.end(); ++it) {
+    edges.push_back(pair<int, int>(it->node1, it->node2));
+    cost.push_back(it->value);
+  }
+}
+
+bool SpanningForest::CompareEdges(const WeightedEdge &lhs, const WeightedEdge &rhs)
+{
+  if (lhs.value != rhs.value) return lhs.value < rhs.value;
+  if (lhs.node1 != rhs.node1) return lhs.node1 < rhs.node1;
+  return lhs.node2 < rhs.node2;
+}
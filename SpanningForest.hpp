@@ -0,0 +1,65 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// SpanningForest.hpp
+
+#ifndef _HW3_SPANNING_FOREST_H_
+#define _HW3_SPANNING_FOREST_H_
+
+#include <vector>
+#include <utility>
+
+#include "UndirectedGraph.hpp"
+
+using namespace std;
+
+// A minimum spanning forest over an edge list that grows as batches of edges are merged
+// into it; the forest after each merge spans all the edges seen so far.
+class SpanningForest
+{
+public:
+  // Constructor; creates an empty forest.
+  // @param numNodes The number of nodes the edges may refer to.
+  SpanningForest(int numNodes);
+
+  // Replaces the forest with the minimum spanning forest of its edges and the batch,
+  // using Kruskal's algorithm; edges with equal values are ordered by their nodes.
+  // @param batch The edges to merge into the forest.
+  void merge(const vector<WeightedEdge> &batch);
+
+  // Gets the edges of the forest, in increasing order of value.
+  // @return The edges of the forest.
+  const vector<WeightedEdge>& getEdges();
+
+  // Copies the forest in the format returned by the graph algorithms.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  void getSpanningTree(vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Gets the number of nodes the edges may refer to.
+  // @return The number of nodes.
+  int getNumNodes();
+
+  // Determines if edge lhs comes before edge rhs in the order used by Kruskal's algorithm.
+  static bool CompareEdges(const WeightedEdge &lhs, const WeightedEdge &rhs);
+
+private:
+  // The number of nodes the edges may refer to.
+  int numNodes;
+
+  // The edges of the forest.
+  vector<WeightedEdge> forestEdges;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline const vector<WeightedEdge>& SpanningForest::getEdges()
+{
+  return forestEdges;
+}
+
+inline int SpanningForest::getNumNodes()
+{
+  return numNodes;
+}
+
+#endif // _HW3_SPANNING_FOREST_H_
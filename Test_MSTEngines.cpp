@@ -0,0 +1,486 @@
+// Differential and performance testing for the minimum spanning tree engines.
+// Every engine and storage backend runs on seeded random graphs and must agree with a
+// reference forest; then the main algorithms run on fixed reference inputs and are measured
+// against their recorded time and memory budgets. The time budgets are loose, and can be
+// scaled with the MST_BUDGET_SCALE environment variable on slower machines; setting
+// MST_BUDGET_REPORT_ONLY only reports the runs over their time budget instead of failing.
+// Usage: Test_MSTEngines [seed], to repeat the random graphs of one reported seed.
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <new>
+#include <map>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "UndirectedGraph.hpp"
+#include "CompressedGraph.hpp"
+#include "GraphSnapshot.hpp"
+#include "SmallGraph.hpp"
+#include "SpanningForest.hpp"
+#include "RandomizedMST.hpp"
+#include "DistributedMST.hpp"
+#include "PipelinedMST.hpp"
+#include "DisjointSet.hpp"
+#include "CustomAssert.hpp"
+
+// Reports the seed of the graph being checked before a failed assertion aborts the run.
+#define ASSERT_FOR_SEED(exp, msg, seed) \
+  do { \
+    bool passed = (exp); \
+    if (!passed) std::cerr << "Failing graph seed: " << (seed) << std::endl; \
+    AssertCheck(passed, (#exp), (msg), true, __func__, __FILE__, __LINE__); \
+  } while (0)
+
+// The heap is tracked by replacing the global allocation functions, which count the usable
+// size of every block, so the bytes in use, and their peak, are known at all times. The usable
+// size comes from glibc's malloc_usable_size, so elsewhere the heap is not tracked and the
+// memory budgets are not checked.
+
+static std::atomic<size_t> liveHeapBytes(0);
+static std::atomic<size_t> peakHeapBytes(0);
+
+#ifdef __GLIBC__
+void* operator new(size_t size)
+{
+  void *block = std::malloc(size);
+  if (block == nullptr) throw std::bad_alloc();
+
+  size_t live = liveHeapBytes += malloc_usable_size(block);
+  size_t peak = peakHeapBytes;
+  while (live > peak && !peakHeapBytes.compare_exchange_weak(peak, live)) {}
+  return block;
+}
+
+// the blocks come from malloc in the operator new above, whatever the compiler infers
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void *block) noexcept
+{
+  if (block == nullptr) return;
+  liveHeapBytes -= malloc_usable_size(block);
+  std::free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+  operator delete(block);
+}
+#endif
+
+// A generated test graph; edges are distinct pairs of distinct nodes with values that every
+// backend, including the float-valued compressed one, stores exactly: integers, or in the
+// fractional family multiples of 1/8 and their nearest larger floats. The repeated family
+// also lists some pairs again with other values, and some edges at 0.0, which the graphs
+// resolve as the last value of a pair winning and 0.0 being no edge.
+struct TestGraph
+{
+  std::string kind; // the family the graph was drawn from
+  uint64_t seed; // the seed the graph was generated from
+  int numNodes; // the number of nodes
+  std::vector<WeightedEdge> edgeList; // the edges
+  bool distinctValues; // true if no two edges have the same value
+};
+
+// Adds an edge between two random nodes of [first, first + count) that are not connected yet.
+static void addRandomEdge(TestGraph &graph, std::map<std::pair<int, int>, double> &present, std::mt19937_64 &generator,
+                          int first, int count, double value)
+{
+  std::uniform_int_distribution<int> nodes(first, first + count - 1);
+  for (;;) {
+    int node1 = nodes(generator), node2 = nodes(generator);
+    if (node1 == node2 || present.count(std::minmax(node1, node2)) > 0) continue;
+    present[std::minmax(node1, node2)] = value;
+    graph.edgeList.push_back(WeightedEdge{ node1, node2, value });
+    return;
+  }
+}
+
+// Generates a graph of the given family.
+// @param kind One of "sparse", "dense", "disconnected", "duplicate", "fractional", "repeated" or "large".
+// @param seed The seed to generate it from.
+static TestGraph makeGraph(const std::string &kind, uint64_t seed)
+{
+  std::mt19937_64 generator(seed);
+  TestGraph graph;
+  graph.kind = kind;
+  graph.seed = seed;
+  graph.distinctValues = (kind != "duplicate");
+  std::map<std::pair<int, int>, double> present;
+
+  // every family but the duplicate and fractional ones draws its values as a shuffled 1..m
+  int numEdges;
+  if (kind == "sparse") {
+    graph.numNodes = 50 + generator() % 1500;
+    numEdges = graph.numNodes * (2 + generator() % 4);
+  }
+  else if (kind == "dense") {
+    graph.numNodes = 20 + generator() % 100;
+    numEdges = int(graph.numNodes * (graph.numNodes - 1) / 2 * (0.5 + 0.4 * (generator() % 100) / 100.0));
+  }
+  else if (kind == "large") {
+    graph.numNodes = 20000;
+    numEdges = 100000;
+  }
+  else if (kind == "repeated") {
+    // every other seed small enough for SmallGraph
+    graph.numNodes = (seed % 2 == 0) ? 20 + generator() % 45 : 30 + generator() % 400;
+    numEdges = graph.numNodes * 3;
+  }
+  else { // disconnected, duplicate or fractional
+    graph.numNodes = 30 + generator() % 400;
+    numEdges = graph.numNodes * 3;
+  }
+
+  std::vector<double> values(numEdges);
+  if (kind == "fractional") {
+    // values off the integer grid, in pairs one float apart, so that the bucket queue has no
+    // exact resolution and the engines must tell near ties apart
+    for (int i = 0; i < numEdges; ++i) {
+      float value = float(i / 2 + 1) * 0.375f;
+      values[i] = (i % 2 == 0) ? value : std::nextafter(value, 1e30f);
+    }
+    std::shuffle(values.begin(), values.end(), generator);
+  }
+  else if (graph.distinctValues) {
+    std::iota(values.begin(), values.end(), 1.0);
+    std::shuffle(values.begin(), values.end(), generator);
+  }
+  else {
+    for (double &value : values)
+      value = double(1 + generator() % 3);
+  }
+
+  if (kind == "disconnected") {
+    // several components of random sizes, each with its share of the edges, and a few
+    // nodes with no edges at all
+    int numComponents = 2 + generator() % 6;
+    int first = 0;
+    for (int c = 0; c < numComponents; ++c) {
+      int count = (graph.numNodes - 5 - first) / (numComponents - c);
+      int componentEdges = std::min(numEdges / numComponents, count * (count - 1) / 2);
+      for (int i = 0; i < componentEdges; ++i)
+        addRandomEdge(graph, present, generator, first, count, values[graph.edgeList.size()]);
+      first += count;
+    }
+  }
+  else if (kind == "repeated") {
+    // a quarter of the lines repeat an earlier pair, either way round, with a new value, and
+    // an eighth are 0.0; values stay distinct, so the resolved graph has a unique forest
+    for (int i = 0; i < numEdges; ++i) {
+      double value = (generator() % 8 == 0) ? 0.0 : values[i];
+      if (i > 0 && generator() % 4 == 0) {
+        WeightedEdge edge = graph.edgeList[generator() % graph.edgeList.size()];
+        if (generator() % 2 == 0) std::swap(edge.node1, edge.node2);
+        edge.value = value;
+        graph.edgeList.push_back(edge);
+      }
+      else
+        addRandomEdge(graph, present, generator, 0, graph.numNodes, value);
+    }
+  }
+  else {
+    numEdges = std::min(numEdges, graph.numNodes * (graph.numNodes - 1) / 2);
+    for (int i = 0; i < numEdges; ++i)
+      addRandomEdge(graph, present, generator, 0, graph.numNodes, values[i]);
+  }
+  return graph;
+}
+
+// An engine: a way to compute the minimum spanning forest of a test graph.
+struct Engine
+{
+  const char *name; // the engine and backend
+  int maxNodes; // the largest graph the engine is run on
+  void (*run)(const TestGraph &graph, std::vector<std::pair<int, int>> &edges, std::vector<double> &cost);
+};
+
+static const Engine Engines[] = {
+  // the dense matrix is only used up to a few thousand nodes
+  { "UndirectedGraph Prim", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runPrimAlgorithm(e, c); } },
+  { "UndirectedGraph Prim, bucket queue", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runPrimAlgorithm(e, c, QueueType::BucketQueue); } },
+  { "UndirectedGraph Kruskal", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runKruskalAlgorithm(e, c); } },
+  { "UndirectedGraph Kruskal, radix heap", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runKruskalAlgorithm(e, c, QueueType::RadixHeap); } },
+  { "UndirectedGraph Kruskal, bucket queue", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runKruskalAlgorithm(e, c, QueueType::BucketQueue); } },
+  { "UndirectedGraph parallel Prim", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runParallelPrimAlgorithm(e, c, 4); } },
+  { "UndirectedGraph Karger-Klein-Tarjan", 5000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UndirectedGraph(g.numNodes, g.edgeList).runKargerKleinTarjanAlgorithm(e, c, g.seed); } },
+  { "CompressedGraph Prim", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      CompressedGraph(g.numNodes, g.edgeList).runPrimAlgorithm(e, c); } },
+  { "CompressedGraph Kruskal", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      CompressedGraph(g.numNodes, g.edgeList).runKruskalAlgorithm(e, c); } },
+  { "CompressedGraph parallel Prim", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      CompressedGraph(g.numNodes, g.edgeList).runParallelPrimAlgorithm(e, c, 3); } },
+  { "CompressedGraph Karger-Klein-Tarjan", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      CompressedGraph(g.numNodes, g.edgeList).runKargerKleinTarjanAlgorithm(e, c, g.seed + 1); } },
+  { "GraphSnapshot Prim", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      SnapshotWriter(g.numNodes, g.edgeList).getSnapshot()->runPrimAlgorithm(e, c); } },
+  { "GraphSnapshot Kruskal", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      SnapshotWriter(g.numNodes, g.edgeList).getSnapshot()->runKruskalAlgorithm(e, c); } },
+  { "SpanningForest, three batches", 1 << 30, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      // the forest merges edges as given, so the list is resolved to the graph's rules first
+      std::vector<WeightedEdge> list(g.edgeList);
+      UndirectedGraph::resolveEdgeList(list);
+      SpanningForest forest(g.numNodes);
+      size_t third = list.size() / 3;
+      forest.merge(std::vector<WeightedEdge>(list.begin(), list.begin() + third));
+      forest.merge(std::vector<WeightedEdge>(list.begin() + third, list.begin() + 2 * third));
+      forest.merge(std::vector<WeightedEdge>(list.begin() + 2 * third, list.end()));
+      forest.getSpanningTree(e, c); } },
+  { "SmallGraph Prim", 64, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      SmallGraph<64> small(g.numNodes);
+      for (const WeightedEdge &edge : g.edgeList)
+        small.setEdgeValue(edge.node1, edge.node2, edge.value);
+      small.runPrimAlgorithm(e, c); } },
+  { "DistributedMST, three processes", 2000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      UnixSocketTransport transport(3);
+      DistributedMST distributed(transport);
+      if (!distributed.run(g.numNodes, g.edgeList, e, c)) e.clear(); } },
+  { "PipelinedMST", 2000, [](const TestGraph &g, std::vector<std::pair<int, int>> &e, std::vector<double> &c) {
+      char filename[] = "/tmp/mstengineXXXXXX";
+      int descriptor = mkstemp(filename);
+      if (descriptor < 0) { e.clear(); return; }
+      close(descriptor);
+      {
+        std::ofstream outfile(filename);
+        outfile << std::setprecision(17) << g.numNodes << std::endl;
+        for (const WeightedEdge &edge : g.edgeList)
+          outfile << edge.node1 << " " << edge.node2 << " " << edge.value << std::endl;
+      }
+      PipelinedMST pipeline(2, 256, 4);
+      if (!pipeline.run(filename, e, c)) e.clear();
+      std::remove(filename); } },
+};
+
+// Checks that a spanning forest agrees with the reference forest of its graph: it uses edges
+// of the graph at their values, has no cycle, has as many edges (so it spans every
+// component) and costs the same; on distinct values it must be the very same forest. Costs
+// are summed in increasing order, as for the reference, so fractional values add up the same.
+static void checkForest(const TestGraph &graph, const std::map<std::pair<int, int>, double> &values, const char *engine,
+                        const std::vector<std::pair<int, int>> &referenceEdges, double referenceCost,
+                        std::vector<std::pair<int, int>> edges, const std::vector<double> &cost)
+{
+  std::string context = graph.kind + " graph, " + engine;
+  ASSERT_FOR_SEED(edges.size() == referenceEdges.size() && cost.size() == edges.size(),
+                  (context + ": forest size check").c_str(), graph.seed);
+
+  DisjointSet ds(graph.numNodes);
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (edges[i].first > edges[i].second)
+      std::swap(edges[i].first, edges[i].second);
+    auto value = values.find(edges[i]);
+    ASSERT_FOR_SEED(value != values.end() && value->second == cost[i], (context + ": forest edge check").c_str(), graph.seed);
+    ASSERT_FOR_SEED(!ds.isConnected(edges[i].first, edges[i].second), (context + ": forest cycle check").c_str(), graph.seed);
+    ds.merge(edges[i].first, edges[i].second);
+  }
+
+  std::vector<double> sortedCost(cost);
+  std::sort(sortedCost.begin(), sortedCost.end());
+  ASSERT_FOR_SEED(std::accumulate(sortedCost.begin(), sortedCost.end(), 0.0) == referenceCost,
+                  (context + ": forest cost check").c_str(), graph.seed);
+
+  if (graph.distinctValues) {
+    std::sort(edges.begin(), edges.end());
+    ASSERT_FOR_SEED(edges == referenceEdges, (context + ": unique forest check").c_str(), graph.seed);
+  }
+}
+
+// Runs every engine on graphs of every family and compares their forests.
+static void TestEngineAgreement(uint64_t firstSeed, int numSeeds)
+{
+  std::cerr << "Running Test for Engine Agreement..." << std::endl;
+
+  const char *kinds[] = { "sparse", "dense", "disconnected", "duplicate", "fractional", "repeated", "large" };
+  for (const char *kind : kinds) {
+    int count = (std::string(kind) == "large") ? 1 : numSeeds;
+    for (uint64_t seed = firstSeed; seed < firstSeed + count; ++seed) {
+      TestGraph graph = makeGraph(kind, seed);
+
+      // the graph's rules, applied here without the backends' code: the last value of a pair
+      // wins, and 0.0 is no edge
+      std::map<std::pair<int, int>, double> values;
+      for (const WeightedEdge &edge : graph.edgeList)
+        values[std::minmax(edge.node1, edge.node2)] = edge.value;
+      std::vector<WeightedEdge> sorted;
+      for (auto it = values.begin(); it != values.end();) {
+        if (it->second == 0.0)
+          it = values.erase(it);
+        else {
+          sorted.push_back(WeightedEdge{ it->first.first, it->first.second, it->second });
+          ++it;
+        }
+      }
+
+      // Kruskal's algorithm over the resolved edges, sharing no code with the graph backends
+      std::sort(sorted.begin(), sorted.end(), [](const WeightedEdge &lhs, const WeightedEdge &rhs) {
+        return lhs.value < rhs.value;
+      });
+      std::vector<std::pair<int, int>> referenceEdges;
+      double referenceCost = 0.0;
+      DisjointSet ds(graph.numNodes);
+      for (const WeightedEdge &edge : sorted) {
+        if (!ds.isConnected(edge.node1, edge.node2)) {
+          ds.merge(edge.node1, edge.node2);
+          referenceEdges.push_back(std::minmax(edge.node1, edge.node2));
+          referenceCost += edge.value;
+        }
+      }
+      std::sort(referenceEdges.begin(), referenceEdges.end());
+
+      for (const Engine &engine : Engines) {
+        if (graph.numNodes > engine.maxNodes) continue;
+        std::vector<std::pair<int, int>> edges;
+        std::vector<double> cost;
+        engine.run(graph, edges, cost);
+        checkForest(graph, values, engine.name, referenceEdges, referenceCost, edges, cost);
+      }
+    }
+  }
+  ASSERT_CONDITION_SHOW_PASS(true, "Engine agreement check");
+}
+
+// A recorded budget for one engine on a reference input.
+struct Budget
+{
+  const char *name; // the engine and input
+  double seconds; // the most time one run may take
+  size_t memoryBytes; // the most memory the input graph and the run's peak heap use may add up to
+};
+
+// Runs the function a few times and checks its best time, and the storage of its input graph
+// plus its peak heap use, against the budget. The graph's storage is counted from its own
+// report, since the dense matrix is mapped or aligned outside the tracked heap. The time
+// budgets are scaled by the MST_BUDGET_SCALE environment variable, for slower machines; a run
+// over its time budget fails the test unless MST_BUDGET_REPORT_ONLY is set.
+// @param storageBytes The memory held by the input graph before the run.
+template <typename Function>
+static void checkBudget(const Budget &budget, size_t storageBytes, Function function)
+{
+  static double scale = std::getenv("MST_BUDGET_SCALE") ? std::atof(std::getenv("MST_BUDGET_SCALE")) : 1.0;
+  static bool reportOnly = std::getenv("MST_BUDGET_REPORT_ONLY") != nullptr;
+
+  double bestSeconds = 1e300;
+  size_t peakBytes = 0;
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    size_t startBytes = liveHeapBytes;
+    peakHeapBytes = startBytes;
+    auto start = std::chrono::steady_clock::now();
+    function();
+    bestSeconds = std::min(bestSeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    peakBytes = std::max(peakBytes, size_t(peakHeapBytes) - startBytes);
+  }
+
+  std::cerr << "  " << budget.name << ": " << std::fixed << std::setprecision(3) << bestSeconds << " s of "
+            << budget.seconds * scale << ", ";
+#ifdef __GLIBC__
+  std::cerr << storageBytes << " + " << peakBytes << " bytes of " << budget.memoryBytes << std::endl;
+#else
+  std::cerr << storageBytes << " bytes of graph, heap not tracked" << std::endl;
+#endif
+  if (!reportOnly)
+    ASSERT_CONDITION(bestSeconds <= budget.seconds * scale, (std::string(budget.name) + ": time budget check").c_str());
+  else if (bestSeconds > budget.seconds * scale)
+    std::cerr << "  " << budget.name << ": over its time budget (not fatal with MST_BUDGET_REPORT_ONLY)" << std::endl;
+#ifdef __GLIBC__
+  ASSERT_CONDITION(storageBytes + peakBytes <= budget.memoryBytes, (std::string(budget.name) + ": memory budget check").c_str());
+#else
+  ASSERT_CONDITION(storageBytes <= budget.memoryBytes, (std::string(budget.name) + ": memory budget check").c_str());
+#endif
+}
+
+// Measures the main algorithms on fixed reference inputs. The budgets were recorded at about
+// eight times the measured time and a quarter more than the measured memory.
+static void TestPerformanceBudgets()
+{
+  std::cerr << "Running Test for Performance Budgets..." << std::endl;
+
+  static const Budget budgets[] = {
+    { "Prim, dense UndirectedGraph", 0.40, 43000000 },
+    { "Kruskal, dense UndirectedGraph", 1.00, 43000000 },
+    { "Prim, sparse CompressedGraph", 1.20, 29000000 },
+    { "Kruskal, sparse CompressedGraph", 1.00, 31000000 },
+    { "DisjointSet, merges and queries", 1.60, 40000000 },
+  };
+
+  std::vector<std::pair<int, int>> edges;
+  std::vector<double> cost;
+  edges.reserve(1 << 20);
+  cost.reserve(1 << 20);
+
+  std::mt19937 generator(2);
+  UndirectedGraph dense(1500, 0.0, std::pair<double, double>(0.0, 0.0));
+  for (int i = 0; i < dense.getNumNodes(); ++i) {
+    for (int j = i + 1; j < dense.getNumNodes(); ++j) {
+      if (generator() % 5 < 3)
+        dense.setEdgeValue(i, j, 1.0 + generator() % 1000);
+    }
+  }
+  checkBudget(budgets[0], dense.getMemoryUsage(), [&]() { MinimumSpanningTree<UndirectedGraph>::runPrimAlgorithm(dense, edges, cost); });
+  checkBudget(budgets[1], dense.getMemoryUsage(), [&]() { MinimumSpanningTree<UndirectedGraph>::runKruskalAlgorithm(dense, edges, cost); });
+
+  TestGraph sparse = makeGraph("large", 12345);
+  for (int i = 0; i < 4; ++i) { // a larger sparse graph, built from the large family
+    TestGraph part = makeGraph("large", 12346 + i);
+    for (WeightedEdge edge : part.edgeList) {
+      edge.node1 += (i + 1) * part.numNodes;
+      edge.node2 += (i + 1) * part.numNodes;
+      sparse.edgeList.push_back(edge);
+    }
+    sparse.edgeList.push_back(WeightedEdge{ i * part.numNodes, (i + 1) * part.numNodes, 1.0 });
+  }
+  sparse.numNodes *= 5;
+  CompressedGraph compressed(sparse.numNodes, sparse.edgeList);
+  checkBudget(budgets[2], compressed.getMemoryUsage(), [&]() { compressed.runPrimAlgorithm(edges, cost); });
+  checkBudget(budgets[3], compressed.getMemoryUsage(), [&]() { compressed.runKruskalAlgorithm(edges, cost); });
+
+  checkBudget(budgets[4], 0, [&]() {
+    const int numElements = 1000000;
+    DisjointSet ds(numElements);
+    generator.seed(3);
+    int connected = 0;
+    for (int i = 0; i < 2 * numElements; ++i) {
+      int node1 = generator() % numElements, node2 = generator() % numElements;
+      if (i % 2 == 0)
+        ds.merge(node1, node2);
+      else
+        connected += ds.isConnected(node1, node2);
+    }
+    ASSERT_CONDITION(connected > 0 && ds.getNumSets() < numElements, "DisjointSet budget workload check");
+  });
+
+  ASSERT_CONDITION_SHOW_PASS(true, "Performance budget check");
+}
+
+int main(int argc, char **argv)
+{
+  // a reported seed repeats just that seed's graphs
+  if (argc > 1) {
+    TestEngineAgreement(std::strtoull(argv[1], nullptr, 10), 1);
+    return 0;
+  }
+
+  TestEngineAgreement(1, 8);
+  TestPerformanceBudgets();
+
+  return 0;
+}
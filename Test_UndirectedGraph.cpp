@@ -3,8 +3,26 @@
 #include <iostream>
 #include <algorithm>
 #include <utility>
+#include <numeric>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <thread>
+#include <atomic>
+#include <map>
 
 #include "UndirectedGraph.hpp"
+#include "NodeReordering.hpp"
+#include "CompressedGraph.hpp"
+#include "DistributedMST.hpp"
+#include "PipelinedMST.hpp"
+#include "SpanningForest.hpp"
+#include "SmallGraph.hpp"
+#include "MSTDiskCache.hpp"
+#include "GraphSnapshot.hpp"
+#include "RandomizedMST.hpp"
 #include "CustomAssert.hpp"
 
 void UndirectedGraph_TestNodeSanity()
@@ -164,6 +182,768 @@ void UndirectedGraph_TestReadFromFile()
   ASSERT_CONDITION(test.getEdgeValue(10, 14) == 25.0, "Edge value test");
 }
 
+void UndirectedGraph_TestReordering()
+{
+  std::cerr << "Running Test for Node Reordering..." << std::endl;
+
+  // a path whose node IDs are scattered: 0 - 37 - 74 - 11 - ...
+  vector<WeightedEdge> edgeList;
+  for (int i = 0; i < 99; i++)
+    edgeList.push_back(WeightedEdge{ (i * 37) % 100, ((i + 1) * 37) % 100, 1.0 + i % 7 });
+  UndirectedGraph original(100, edgeList);
+
+  ReorderingStrategy strategies[] = { ReorderingStrategy::BreadthFirst,
+                                      ReorderingStrategy::ReverseCuthillMcKee,
+                                      ReorderingStrategy::DegreeSorted };
+  for (auto strategy : strategies) {
+    vector<WeightedEdge> relabeled(edgeList);
+    NodeReordering reordering(100, relabeled, strategy);
+    reordering.relabel(relabeled);
+
+    for (int i = 0; i < 100; i++)
+      ASSERT_CONDITION(reordering.getOriginalID(reordering.getNewID(i)) == i, "Reordering permutation check");
+    if (strategy != ReorderingStrategy::DegreeSorted)
+      ASSERT_CONDITION(reordering.getBandwidthAfter() == 1, "Reordering bandwidth check");
+
+    UndirectedGraph reordered(100, relabeled);
+    vector<pair<int, int>> edges;
+    vector<double> cost;
+    reordered.runKruskalAlgorithm(edges, cost);
+    reordering.restore(edges);
+    ASSERT_CONDITION(edges.size() == 99, "Reordered MST edge count check");
+    for (int i = 0; i < edges.size(); i++)
+      ASSERT_CONDITION(original.getEdgeValue(edges[i].first, edges[i].second) == cost[i], "Restored MST edge check");
+    ASSERT_CONDITION(reordering.isValid(), "Reordering valid input check");
+  }
+
+  // node IDs outside the graph are rejected rather than indexed
+  int badIDs[] = { 100, -1 };
+  for (int badID : badIDs) {
+    vector<WeightedEdge> invalid(edgeList);
+    invalid.push_back(WeightedEdge{ 5, badID, 2.0 });
+    NodeReordering reordering(100, invalid, ReorderingStrategy::ReverseCuthillMcKee);
+    ASSERT_CONDITION(!reordering.isValid() && reordering.getNewID(42) == 42, "Reordering invalid ID check");
+  }
+  ASSERT_CONDITION_SHOW_PASS(true, "Reordering check");
+}
+
+void UndirectedGraph_TestCompressedBackend()
+{
+  std::cerr << "Running Test for Compressed Backend..." << std::endl;
+
+  // dense enough that most rows span several blocks; distances are exact as floats
+  UndirectedGraph dense(300, 0.5, std::pair<double, double>(1.0, 100.0));
+  vector<WeightedEdge> edgeList;
+  for (int i = 0; i < 300; i++) {
+    for (int j = i + 1; j < 300; j++) {
+      if (dense.isAdjacent(i, j)) {
+        dense.setEdgeValue(i, j, float(dense.getEdgeValue(i, j)));
+        edgeList.push_back(WeightedEdge{ j, i, dense.getEdgeValue(i, j) });
+      }
+    }
+  }
+  CompressedGraph test(300, edgeList);
+  ASSERT_CONDITION_SHOW_PASS(test.getNumEdges() == dense.getNumEdges(), "Compressed edge count check");
+
+  vector<int> expected, neighbors;
+  for (int i = 0; i < 300; i++) {
+    dense.getNeighbors(i, expected);
+    test.getNeighbors(i, neighbors);
+    ASSERT_CONDITION(neighbors == expected, "Compressed neighbor correctness check");
+    for (int j = 0; j < 300; j++) {
+      ASSERT_CONDITION(test.isAdjacent(i, j) == dense.isAdjacent(i, j), "Compressed adjacency check");
+      ASSERT_CONDITION(test.getEdgeValue(i, j) == dense.getEdgeValue(i, j), "Compressed edge value check");
+    }
+  }
+
+  vector<pair<int, int>> edges;
+  vector<double> cost, expectedCost;
+  dense.runKruskalAlgorithm(edges, expectedCost);
+  test.runKruskalAlgorithm(edges, cost);
+  ASSERT_CONDITION_SHOW_PASS(accumulate(cost.begin(), cost.end(), 0.0) == accumulate(expectedCost.begin(), expectedCost.end(), 0.0),
+                             "Compressed Kruskal cost check");
+  test.runPrimAlgorithm(edges, cost);
+  ASSERT_CONDITION_SHOW_PASS(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - accumulate(expectedCost.begin(), expectedCost.end(), 0.0)) < 1e-6,
+                             "Compressed Prim cost check");
+
+  // a repeated edge keeps its last distance
+  edgeList.assign({ WeightedEdge{ 0, 1, 5.0 }, WeightedEdge{ 1, 0, 2.0 } });
+  CompressedGraph repeated(2, edgeList);
+  ASSERT_CONDITION_SHOW_PASS(repeated.getNumEdges() == 1 && repeated.getEdgeValue(0, 1) == 2.0, "Compressed repeated edge check");
+
+  // a distance of zero is no edge, as in UndirectedGraph, even when it repeats an edge
+  edgeList.assign({ WeightedEdge{ 0, 1, 5.0 }, WeightedEdge{ 1, 2, 0.0 }, WeightedEdge{ 2, 3, 1.0 }, WeightedEdge{ 3, 2, 0.0 } });
+  CompressedGraph zeros(4, edgeList);
+  UndirectedGraph zerosReference(4, edgeList);
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++)
+      ASSERT_CONDITION(zeros.isAdjacent(i, j) == zerosReference.isAdjacent(i, j), "Compressed zero distance check");
+  }
+  ASSERT_CONDITION_SHOW_PASS(zeros.getNumEdges() == 1 && zeros.getDegree(2) == 0, "Compressed zero distance check");
+
+  // reading the file directly gives the same graph as reading its edge list first
+  int numNodes;
+  UndirectedGraph::readEdgeList("SampleTestDataExtra1.txt", numNodes, edgeList);
+  CompressedGraph fromList(numNodes, edgeList), fromFile("SampleTestDataExtra1.txt");
+  ASSERT_CONDITION(fromFile.getNumNodes() == numNodes && fromFile.getNumEdges() == fromList.getNumEdges(), "Compressed file check");
+  for (int i = 0; i < numNodes; i++) {
+    fromList.getNeighbors(i, expected);
+    fromFile.getNeighbors(i, neighbors);
+    ASSERT_CONDITION(neighbors == expected, "Compressed file neighbor check");
+    for (int neighbor : neighbors)
+      ASSERT_CONDITION(fromFile.getEdgeValue(i, neighbor) == fromList.getEdgeValue(i, neighbor), "Compressed file edge value check");
+  }
+  ASSERT_CONDITION_SHOW_PASS(fromFile.getMemoryUsage() == fromList.getMemoryUsage(), "Compressed file check");
+
+  // enough entries to be placed and encoded over several ranges of rows, with repeated and
+  // zero distances among them; every tenth edge repeats an earlier one the other way around
+  const int largeNodes = 20000;
+  std::mt19937 generator(3);
+  edgeList.clear();
+  while (edgeList.size() < 800000) {
+    if (edgeList.size() % 10 == 9) {
+      WeightedEdge earlier = edgeList[generator() % edgeList.size()];
+      edgeList.push_back(WeightedEdge{ earlier.node2, earlier.node1, double(generator() % 4) });
+      continue;
+    }
+    int node1 = generator() % largeNodes, node2 = generator() % largeNodes;
+    if (node1 != node2)
+      edgeList.push_back(WeightedEdge{ node1, node2, double(generator() % 4) });
+  }
+  std::map<pair<int, int>, double> lastValues;
+  for (const WeightedEdge &edge : edgeList)
+    lastValues[std::minmax(edge.node1, edge.node2)] = edge.value;
+  vector<vector<pair<int, double>>> expectedRows(largeNodes);
+  int64_t expectedEdges = 0;
+  for (const auto &entry : lastValues) {
+    if (entry.second == 0.0) continue;
+    expectedRows[entry.first.first].push_back(pair<int, double>(entry.first.second, entry.second));
+    expectedRows[entry.first.second].push_back(pair<int, double>(entry.first.first, entry.second));
+    expectedEdges++;
+  }
+
+  CompressedGraph large(largeNodes, edgeList);
+  ASSERT_CONDITION(large.getNumEdges() == expectedEdges, "Compressed ranges edge count check");
+  for (int i = 0; i < largeNodes; i++) {
+    std::sort(expectedRows[i].begin(), expectedRows[i].end());
+    large.getNeighbors(i, neighbors);
+    ASSERT_CONDITION(neighbors.size() == expectedRows[i].size(), "Compressed ranges degree check");
+    for (size_t j = 0; j < neighbors.size(); j++) {
+      ASSERT_CONDITION(neighbors[j] == expectedRows[i][j].first && large.getEdgeValue(i, neighbors[j]) == expectedRows[i][j].second,
+                       "Compressed ranges neighbor check");
+    }
+  }
+  ASSERT_CONDITION_SHOW_PASS(true, "Compressed ranges check");
+}
+
+void UndirectedGraph_TestDistributed()
+{
+  std::cerr << "Running Test for Distributed MST..." << std::endl;
+
+  int numNodes;
+  vector<WeightedEdge> edgeList;
+  UndirectedGraph::readEdgeList("SampleTestData.txt", numNodes, edgeList);
+  UndirectedGraph test(numNodes, edgeList);
+
+  vector<pair<int, int>> edges;
+  vector<double> cost;
+  test.runKruskalAlgorithm(edges, cost);
+  double expected = accumulate(cost.begin(), cost.end(), 0.0);
+
+  for (int numProcesses = 1; numProcesses <= 5; numProcesses++) {
+    UnixSocketTransport transport(numProcesses);
+    DistributedMST distributed(transport);
+    ASSERT_CONDITION(distributed.run(numNodes, edgeList, edges, cost), "Distributed run check");
+    ASSERT_CONDITION(edges.size() == numNodes - 1, "Distributed edge count check");
+    ASSERT_CONDITION(accumulate(cost.begin(), cost.end(), 0.0) == expected, "Distributed cost check");
+    ASSERT_CONDITION(distributed.getRoundBytes(0) == 0, "Distributed local round check");
+    if (numProcesses > 1)
+      ASSERT_CONDITION(distributed.getRoundBytes(1) > 0, "Distributed communication check");
+  }
+
+  // a used transport and an edge outside the graph are reported as failures
+  UnixSocketTransport transport(3);
+  DistributedMST distributed(transport);
+  ASSERT_CONDITION(distributed.run(numNodes, edgeList, edges, cost), "Distributed run check");
+  ASSERT_CONDITION(!distributed.run(numNodes, edgeList, edges, cost), "Distributed used transport check");
+  UnixSocketTransport unused(3);
+  DistributedMST outOfRange(unused);
+  edgeList.push_back(WeightedEdge{ 0, numNodes, 1.0 });
+  ASSERT_CONDITION(!outOfRange.run(numNodes, edgeList, edges, cost) && edges.empty(), "Distributed node range check");
+
+  // a repeated edge keeps its last distance and a distance of 0.0 is no edge, as in UndirectedGraph,
+  // even when the lines end up with different workers
+  vector<vector<WeightedEdge>> ruleLists = {
+    { WeightedEdge{ 0, 1, 1.0 }, WeightedEdge{ 1, 2, 4.0 }, WeightedEdge{ 0, 1, 5.0 }, WeightedEdge{ 0, 2, 3.0 } },
+    { WeightedEdge{ 0, 1, 1.0 }, WeightedEdge{ 1, 2, 4.0 }, WeightedEdge{ 1, 0, 0.0 }, WeightedEdge{ 0, 2, 3.0 } },
+    { WeightedEdge{ 0, 1, 0.0 }, WeightedEdge{ 1, 2, 4.0 }, WeightedEdge{ 2, 1, 2.0 }, WeightedEdge{ 0, 2, 3.0 } },
+  };
+  for (const vector<WeightedEdge> &ruleList : ruleLists) {
+    UndirectedGraph reference(3, ruleList);
+    vector<double> expectedCost;
+    reference.runKruskalAlgorithm(edges, expectedCost);
+    for (int numProcesses = 1; numProcesses <= 4; numProcesses++) {
+      UnixSocketTransport ruleTransport(numProcesses);
+      DistributedMST ruleDistributed(ruleTransport);
+      ASSERT_CONDITION(ruleDistributed.run(3, ruleList, edges, cost), "Distributed run check");
+      ASSERT_CONDITION(cost == expectedCost, "Distributed repeated and zero edge check");
+    }
+  }
+  ASSERT_CONDITION_SHOW_PASS(true, "Distributed MST check");
+}
+
+void UndirectedGraph_TestPipelined()
+{
+  std::cerr << "Running Test for Pipelined MST..." << std::endl;
+
+  const char *files[] = { "SampleTestData.txt", "SampleTestDataExtra1.txt" };
+  for (auto file : files) {
+    UndirectedGraph test(file);
+    vector<pair<int, int>> edges;
+    vector<double> cost;
+    test.runKruskalAlgorithm(edges, cost);
+    double expected = accumulate(cost.begin(), cost.end(), 0.0);
+
+    // vary the split so that ranges and chunks end in the middle of lines
+    for (int numProducers = 1; numProducers <= 7; numProducers += 3) {
+      for (size_t chunkSize = 1; chunkSize <= 64; chunkSize *= 4) {
+        PipelinedMST pipeline(numProducers, chunkSize, 2);
+        ASSERT_CONDITION(pipeline.run(file, edges, cost), "Pipelined run check");
+        ASSERT_CONDITION(edges.size() == test.getNumNodes() - 1, "Pipelined edge count check");
+        ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - expected) < 1e-9, "Pipelined cost check");
+      }
+    }
+  }
+
+  // a repeated edge keeps its last distance and a distance of 0.0 is no edge, as in UndirectedGraph;
+  // the small files hold back nearly every pair, and the large one only some
+  std::mt19937 generator(9);
+  std::string large = "200\n";
+  for (int i = 0; i < 4000; i++)
+    large += std::to_string(generator() % 200) + " " + std::to_string(generator() % 200) + " " + std::to_string(generator() % 6) + "\n";
+  const char *contents[] = { "3\n0 1 1\n1 2 4\n0 1 5\n0 2 3\n", "3\n0 1 1\n1 2 4\n0 1 0\n0 2 3\n",
+                             "3\n0 1 0\n1 2 4\n2 1 2\n0 2 3\n1 0 6\n", large.c_str() };
+  char filename[] = "/tmp/mstpipelineXXXXXX";
+  int descriptor = mkstemp(filename);
+  ASSERT_CONDITION(descriptor >= 0, "Pipelined file check");
+  close(descriptor);
+  for (auto content : contents) {
+    std::ofstream(filename) << content;
+    UndirectedGraph reference(filename);
+    vector<pair<int, int>> edges;
+    vector<double> cost, expectedCost;
+    reference.runKruskalAlgorithm(edges, expectedCost);
+    double expected = accumulate(expectedCost.begin(), expectedCost.end(), 0.0);
+    for (int numProducers = 1; numProducers <= 3; numProducers++) {
+      PipelinedMST pipeline(numProducers, 16, 2);
+      ASSERT_CONDITION(pipeline.run(filename, edges, cost), "Pipelined run check");
+      ASSERT_CONDITION(edges.size() == expectedCost.size() && accumulate(cost.begin(), cost.end(), 0.0) == expected,
+                       "Pipelined repeated and zero edge check");
+    }
+  }
+
+  // a node outside the graph fails the run
+  std::ofstream(filename) << "3\n0 1 1\n1 3 4\n";
+  vector<pair<int, int>> edges;
+  vector<double> cost;
+  PipelinedMST pipeline;
+  ASSERT_CONDITION(!pipeline.run(filename, edges, cost) && edges.empty(), "Pipelined node range check");
+  std::remove(filename);
+  ASSERT_CONDITION_SHOW_PASS(true, "Pipelined MST check");
+}
+
+// Helper function to compare a small graph's spanning forest with Kruskal's on the same edges.
+template <int N>
+void checkSmallGraph(int numNodes, double density)
+{
+  UndirectedGraph reference(numNodes, density, std::pair<double, double>(1.0, 10.0));
+  SmallGraph<N> test(numNodes);
+  for (int i = 0; i < numNodes; i++) {
+    for (int j = i + 1; j < numNodes; j++) {
+      if (reference.isAdjacent(i, j))
+        test.addEdge(i, j, reference.getEdgeValue(i, j));
+    }
+  }
+  ASSERT_CONDITION(test.getNumEdges() == reference.getNumEdges(), "Small graph edge count check");
+
+  vector<pair<int, int>> edges;
+  vector<double> cost, expectedCost;
+  reference.runKruskalAlgorithm(edges, expectedCost);
+
+  SmallSpanningTree<N> tree;
+  test.runPrimAlgorithm(tree);
+  ASSERT_CONDITION(tree.numEdges == expectedCost.size(), "Small graph forest size check");
+  ASSERT_CONDITION(std::abs(tree.totalCost - accumulate(expectedCost.begin(), expectedCost.end(), 0.0)) < 1e-9,
+                   "Small graph cost check");
+
+  test.runPrimAlgorithm(edges, cost);
+  for (int i = 0; i < edges.size(); i++)
+    ASSERT_CONDITION(test.getEdgeValue(edges[i].first, edges[i].second) == cost[i], "Small graph edge check");
+
+  // the generic engines run on a small graph too
+  MinimumSpanningTree<SmallGraph<N>>::runPrimAlgorithm(test, edges, cost);
+  ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - tree.totalCost) < 1e-9, "Small graph generic Prim check");
+  MinimumSpanningTree<SmallGraph<N>>::runKruskalAlgorithm(test, edges, cost);
+  ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - tree.totalCost) < 1e-9, "Small graph generic Kruskal check");
+}
+
+void UndirectedGraph_TestSmallGraph()
+{
+  std::cerr << "Running Test for Small Graphs..." << std::endl;
+
+  for (int i = 0; i < 20; i++) {
+    checkSmallGraph<64>(64, 0.3);
+    checkSmallGraph<64>(64, 0.02); // almost certainly disconnected
+    checkSmallGraph<64>(40, 0.5);
+    checkSmallGraph<8>(8, 0.6);
+    checkSmallGraph<1>(1, 1.0);
+  }
+
+  SmallGraph<4> test;
+  test.addEdge(0, 1, 2.0);
+  test.addEdge(1, 2, 3.0);
+  test.addEdge(0, 2, 1.0);
+  test.deleteEdge(0, 2);
+  ASSERT_CONDITION_SHOW_PASS(test.getNumEdges() == 2 && !test.isAdjacent(2, 0), "Small graph delete check");
+
+  // a value of 0.0 is no edge, in both the dense kernel and the generic engines
+  test.setEdgeValue(1, 2, 0.0);
+  test.setEdgeValue(2, 3, 0.0);
+  test.addEdge(0, 3, 4.0);
+  ASSERT_CONDITION(test.getNumEdges() == 2 && !test.isAdjacent(1, 2) && !test.isAdjacent(3, 2), "Small graph zero value check");
+  vector<pair<int, int>> edges;
+  vector<double> cost;
+  test.runPrimAlgorithm(edges, cost);
+  ASSERT_CONDITION(edges.size() == 2 && accumulate(cost.begin(), cost.end(), 0.0) == 6.0, "Small graph zero value Prim check");
+  MinimumSpanningTree<SmallGraph<4>>::runKruskalAlgorithm(test, edges, cost);
+  ASSERT_CONDITION_SHOW_PASS(edges.size() == 2 && accumulate(cost.begin(), cost.end(), 0.0) == 6.0, "Small graph zero value check");
+}
+
+void UndirectedGraph_TestQueueTypes()
+{
+  std::cerr << "Running Test for Priority Queue Types..." << std::endl;
+
+  // integral, fixed-point and arbitrary edge values
+  UndirectedGraph graphs[] = { UndirectedGraph("SampleTestData.txt"),
+                               UndirectedGraph("SampleTestDataExtra1.txt"),
+                               UndirectedGraph(200, 0.2, std::pair<double, double>(1.0, 10.0)) };
+  QueueType queueTypes[] = { QueueType::BinaryHeap, QueueType::RadixHeap, QueueType::BucketQueue };
+  for (auto &test : graphs) {
+    vector<pair<int, int>> edges;
+    vector<double> cost;
+    test.runKruskalAlgorithm(edges, cost);
+    double expected = accumulate(cost.begin(), cost.end(), 0.0);
+
+    for (auto queueType : queueTypes) {
+      test.runKruskalAlgorithm(edges, cost, queueType);
+      ASSERT_CONDITION(edges.size() == test.getNumNodes() - 1, "Kruskal queue type edge count check");
+      ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - expected) < 1e-9, "Kruskal queue type cost check");
+      test.runPrimAlgorithm(edges, cost, queueType);
+      ASSERT_CONDITION(edges.size() == test.getNumNodes() - 1, "Prim queue type edge count check");
+      ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - expected) < 1e-9, "Prim queue type cost check");
+    }
+  }
+
+  // values a hair above a multiple of the resolution must not share its bucket: the three
+  // nearly equal edges of a triangle, and decimals mixed with values just above them
+  vector<WeightedEdge> triangle = { WeightedEdge{ 0, 1, 1.0000001 }, WeightedEdge{ 0, 2, 1.0000003 },
+                                    WeightedEdge{ 1, 2, 1.0000005 } };
+  vector<WeightedEdge> decimals;
+  std::default_random_engine nearGenerator(11);
+  for (int i = 0; i < 100; i++) {
+    for (int j = i + 1; j < 100; j++) {
+      double value = (3 + nearGenerator() % 50) / 100.0;
+      if (nearGenerator() % 2)
+        value += 1e-9 * (1 + nearGenerator() % 9);
+      decimals.push_back(WeightedEdge{ i, j, value });
+    }
+  }
+  UndirectedGraph nearGraphs[] = { UndirectedGraph(3, triangle), UndirectedGraph(100, decimals) };
+  for (auto &test : nearGraphs) {
+    vector<pair<int, int>> expectedEdges, edges;
+    vector<double> expectedCost, cost;
+    test.runKruskalAlgorithm(expectedEdges, expectedCost);
+    double expected = accumulate(expectedCost.begin(), expectedCost.end(), 0.0);
+
+    for (auto queueType : queueTypes) {
+      test.runKruskalAlgorithm(edges, cost, queueType);
+      ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - expected) < 1e-12, "Kruskal near tie check");
+      test.runPrimAlgorithm(edges, cost, queueType);
+      ASSERT_CONDITION(std::abs(accumulate(cost.begin(), cost.end(), 0.0) - expected) < 1e-12, "Prim near tie check");
+    }
+  }
+
+  // the queues on their own: a radix heap removes in order, even with negative values
+  RadixHeap<int, double> radix;
+  PriorityQueue<int, double, LowValuesFirst> heap;
+  std::default_random_engine generator(7);
+  std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+  for (int i = 0; i < 1000; i++) {
+    double value = distribution(generator);
+    radix.push(i, value);
+    heap.push(i, value);
+  }
+  while (!heap.empty()) {
+    ASSERT_CONDITION(radix.getTopPriority() == heap.getTopPriority(), "Radix heap order check");
+    radix.pop();
+    heap.pop();
+  }
+  ASSERT_CONDITION(radix.empty(), "Radix heap size check");
+
+  // a bucket queue accepts values below the last one removed
+  BucketQueue<int, double> buckets(0.0, 10.0, 0.5);
+  buckets.push(1, 5.0);
+  buckets.push(2, 2.5);
+  ASSERT_CONDITION(buckets.pop() == 2, "Bucket queue order check");
+  buckets.push(3, 0.5);
+  buckets.changePriority(1, 0.0);
+  ASSERT_CONDITION(buckets.pop() == 1 && buckets.pop() == 3 && buckets.empty(), "Bucket queue order check");
+
+  PriorityQueue<int, double> selectable(false);
+  selectable.push(1, 2.0);
+  selectable.push(2, 1.0);
+  selectable.setComparator(true);
+  ASSERT_CONDITION_SHOW_PASS(selectable.top() == 1, "Priority queue comparator check");
+}
+
+void UndirectedGraph_TestPackedStorage()
+{
+  std::cerr << "Running Test for Packed Storage..." << std::endl;
+
+  // small enough for the heap, and large enough to be mapped
+  int sizes[] = { 1, 7, 64, 1000 };
+  for (int size : sizes) {
+    PackedSymmetricMatrix matrix(size);
+    size_t maskBytes = size_t(size) * ((size + 63) / 64) * sizeof(uint64_t);
+    ASSERT_CONDITION(matrix.getMemoryUsage() == size_t(size) * (size + 1) / 2 * sizeof(double) + maskBytes, "Packed size check");
+    for (int i = 0; i < size; i++) {
+      for (int j = 0; j < size; j += 3)
+        matrix.set(i, j, i * 10000.0 + j);
+    }
+
+    PackedSymmetricMatrix copy(matrix);
+    for (int i = 0; i < size; i++) {
+      int expectedColumn = 0;
+      copy.forEachInRow(i, [&](int column, double value) {
+        ASSERT_CONDITION(column == expectedColumn++, "Packed row order check");
+        ASSERT_CONDITION(value == matrix.get(column, i), "Packed symmetry check");
+      });
+      ASSERT_CONDITION(expectedColumn == size, "Packed row length check");
+
+      expectedColumn = i + 1;
+      copy.forEachAboveDiagonal(i, [&](int column, double value) {
+        ASSERT_CONDITION(column == expectedColumn++ && value == matrix.get(i, column), "Packed upper row check");
+      });
+
+      // only the set entries are visited, and (0, 0) was set to zero
+      int previousColumn = -1;
+      int visited = 0;
+      copy.forEachNonzeroInRow(i, [&](int column, double value) {
+        ASSERT_CONDITION(column > previousColumn && value != 0.0 && value == matrix.get(i, column), "Packed nonzero row check");
+        previousColumn = column;
+        visited++;
+      });
+      int expectedNonzero = 0;
+      for (int j = 0; j < size; j++)
+        expectedNonzero += (i % 3 == 0 || j % 3 == 0) && (i != 0 || j != 0);
+      ASSERT_CONDITION(visited == expectedNonzero, "Packed nonzero row length check");
+
+      previousColumn = i;
+      copy.forEachNonzeroAboveDiagonal(i, [&](int column, double value) {
+        ASSERT_CONDITION(column > previousColumn && value != 0.0 && value == matrix.get(i, column), "Packed nonzero upper row check");
+        previousColumn = column;
+      });
+    }
+  }
+
+  UndirectedGraph test(100, 0.0, std::pair<double, double>(1.0, 1.0));
+  test.setEdgeValue(3, 7, 2.0);
+  test.setEdgeValue(7, 3, 4.0);
+  ASSERT_CONDITION_SHOW_PASS(test.getNumEdges() == 1 && test.getEdgeValue(3, 7) == 4.0, "Packed edge overwrite check");
+}
+
+void UndirectedGraph_TestResultCache()
+{
+  std::cerr << "Running Test for Result Cache..." << std::endl;
+
+  UndirectedGraph test("SampleTestData.txt");
+  unsigned long version = test.getVersion();
+
+  std::vector<std::pair<int, int>> edges, cachedEdges;
+  std::vector<double> cost, cachedCost;
+  test.runKruskalAlgorithm(edges, cost);
+  test.runKruskalAlgorithm(cachedEdges, cachedCost);
+  ASSERT_CONDITION(edges == cachedEdges && cost == cachedCost, "Cached result check");
+  test.runKruskalAlgorithm(cachedEdges, cachedCost, QueueType::BucketQueue);
+  ASSERT_CONDITION(std::accumulate(cost.begin(), cost.end(), 0.0) == std::accumulate(cachedCost.begin(), cachedCost.end(), 0.0),
+                   "Cache queue type check");
+
+  // halve the most expensive tree edge, which keeps it in the tree and lowers the cost
+  int largest = std::max_element(cost.begin(), cost.end()) - cost.begin();
+  test.setEdgeValue(edges[largest].first, edges[largest].second, cost[largest] / 2);
+  ASSERT_CONDITION(test.getVersion() != version, "Version change check");
+  test.runPrimAlgorithm(cachedEdges, cachedCost);
+  test.runKruskalAlgorithm(cachedEdges, cachedCost);
+  ASSERT_CONDITION(std::fabs(std::accumulate(cachedCost.begin(), cachedCost.end(), 0.0) -
+                             (std::accumulate(cost.begin(), cost.end(), 0.0) - cost[largest] / 2)) < 1e-9, "Cache invalidation check");
+
+  version = test.getVersion();
+  test.deleteEdge(edges[largest].first, edges[largest].second);
+  ASSERT_CONDITION(test.getVersion() != version, "Delete version check");
+  test.deleteEdge(edges[largest].first, edges[largest].second);
+  test.runPrimAlgorithm(cachedEdges, cachedCost);
+  ASSERT_CONDITION(std::find(cachedEdges.begin(), cachedEdges.end(), edges[largest]) == cachedEdges.end(),
+                   "Deleted edge check");
+
+  // results on disk are found again under the same content hash and variant only
+  char directory[] = "/tmp/mstcacheXXXXXX";
+  ASSERT_CONDITION(mkdtemp(directory) != nullptr, "Cache directory check");
+  uint64_t hash, extraHash;
+  ASSERT_CONDITION(MSTDiskCache::hashFile("SampleTestData.txt", hash), "File hash check");
+  ASSERT_CONDITION(MSTDiskCache::hashFile("SampleTestDataExtra1.txt", extraHash) && hash != extraHash, "Distinct hash check");
+  ASSERT_CONDITION(!MSTDiskCache::hashFile("NoSuchFile.txt", extraHash), "Missing file hash check");
+
+  MSTDiskCache diskCache(directory);
+  std::string key = MSTDiskCache::makeKey(hash, "kruskal");
+  ASSERT_CONDITION(!diskCache.load(key, cachedEdges, cachedCost), "Cache miss check");
+  ASSERT_CONDITION(diskCache.store(key, edges, cost), "Cache store check");
+  ASSERT_CONDITION(diskCache.load(key, cachedEdges, cachedCost), "Cache load check");
+  ASSERT_CONDITION(edges == cachedEdges && cost == cachedCost, "Cache round trip check");
+  ASSERT_CONDITION(!diskCache.load(MSTDiskCache::makeKey(hash, "prim"), cachedEdges, cachedCost), "Cache variant check");
+
+  // an entry that cannot be moved into place (a directory is in the way) leaves no temporary file
+  std::string blocked = std::string(directory) + "/" + MSTDiskCache::makeKey(hash, "blocked") + ".mst";
+  ASSERT_CONDITION(mkdir(blocked.c_str(), 0700) == 0 && std::ofstream(blocked + "/entry").good(), "Cache blocked entry check");
+  ASSERT_CONDITION(!diskCache.store(MSTDiskCache::makeKey(hash, "blocked"), edges, cost), "Cache blocked store check");
+  ASSERT_CONDITION(access((blocked + ".tmp" + std::to_string(getpid())).c_str(), F_OK) != 0, "Cache temporary file check");
+  std::remove((blocked + "/entry").c_str());
+  rmdir(blocked.c_str());
+
+  std::remove((std::string(directory) + "/" + key + ".mst").c_str());
+  ASSERT_CONDITION_SHOW_PASS(rmdir(directory) == 0, "Cache cleanup check");
+}
+
+void UndirectedGraph_TestSnapshots()
+{
+  std::cerr << "Running Test for Graph Snapshots..." << std::endl;
+
+  UndirectedGraph graph("SampleTestData.txt");
+  SnapshotWriter writer("SampleTestData.txt");
+  std::shared_ptr<const GraphSnapshot> first = writer.getSnapshot();
+  ASSERT_CONDITION(first->getNumEdges() == graph.getNumEdges(), "Snapshot edge count check");
+
+  std::vector<std::pair<int, int>> edges, snapshotEdges;
+  std::vector<double> cost, snapshotCost;
+  graph.runKruskalAlgorithm(edges, cost);
+  first->runKruskalAlgorithm(snapshotEdges, snapshotCost);
+  ASSERT_CONDITION(edges == snapshotEdges && cost == snapshotCost, "Snapshot Kruskal check");
+  graph.runPrimAlgorithm(edges, cost);
+  first->runPrimAlgorithm(snapshotEdges, snapshotCost);
+  ASSERT_CONDITION(edges == snapshotEdges && cost == snapshotCost, "Snapshot Prim check");
+
+  // edits are invisible until published, and only copy the rows they touch
+  writer.setEdgeValue(0, 1, 0.5);
+  writer.deleteEdge(2, 3);
+  ASSERT_CONDITION(writer.getSnapshot() == first, "Unpublished edit check");
+  std::shared_ptr<const GraphSnapshot> second = writer.publish();
+  ASSERT_CONDITION(second->getEdgeValue(0, 1) == 0.5 && first->getEdgeValue(0, 1) == graph.getEdgeValue(0, 1),
+                   "Snapshot isolation check");
+  ASSERT_CONDITION(!second->isAdjacent(3, 2) && first->isAdjacent(3, 2) == graph.isAdjacent(3, 2), "Snapshot delete check");
+  ASSERT_CONDITION(second->getVersion() != first->getVersion() && writer.publish() == second, "Snapshot version check");
+  for (int i = 0; i < second->getNumNodes(); i++)
+    ASSERT_CONDITION(second->sharesRow(i, *first) == (i > 3), "Row sharing check");
+
+  // readers keep computing on whole snapshots while the writer changes the graph under them
+  std::atomic<bool> done(false);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; t++) {
+    readers.push_back(std::thread([&writer, &done]() {
+      while (!done) {
+        std::shared_ptr<const GraphSnapshot> snapshot = writer.getSnapshot();
+        std::vector<std::pair<int, int>> primEdges, kruskalEdges;
+        std::vector<double> primCost, kruskalCost;
+        snapshot->runPrimAlgorithm(primEdges, primCost);
+        snapshot->runKruskalAlgorithm(kruskalEdges, kruskalCost);
+        ASSERT_CONDITION(std::fabs(std::accumulate(primCost.begin(), primCost.end(), 0.0) -
+                                   std::accumulate(kruskalCost.begin(), kruskalCost.end(), 0.0)) < 1e-9,
+                         "Concurrent snapshot consistency check");
+
+        int degreeSum = 0;
+        for (int i = 0; i < snapshot->getNumNodes(); i++) {
+          std::vector<int> neighbors;
+          snapshot->getNeighbors(i, neighbors);
+          degreeSum += neighbors.size();
+        }
+        ASSERT_CONDITION(degreeSum == 2 * snapshot->getNumEdges(), "Concurrent snapshot edge count check");
+      }
+    }));
+  }
+
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<int> nodes(0, writer.getNumNodes() - 1);
+  for (int i = 0; i < 2000; i++) {
+    int node1 = nodes(generator), node2 = nodes(generator);
+    if (node1 == node2) continue;
+    if (i % 3 == 0)
+      writer.deleteEdge(node1, node2);
+    else
+      writer.setEdgeValue(node1, node2, 1.0 + i % 17);
+    if (i % 10 == 0) writer.publish();
+  }
+  done = true;
+  for (std::thread &reader : readers)
+    reader.join();
+
+  ASSERT_CONDITION_SHOW_PASS(writer.publish()->getNumEdges() == writer.getNumEdges(), "Snapshot writer check");
+
+  // a distance of 0.0 is no edge, whether it is read or set, as in UndirectedGraph
+  std::vector<WeightedEdge> edgeList = { WeightedEdge{ 0, 1, 1.0 }, WeightedEdge{ 1, 2, 4.0 }, WeightedEdge{ 0, 1, 0.0 },
+                                         WeightedEdge{ 0, 2, 3.0 }, WeightedEdge{ 2, 3, 0.0 } };
+  UndirectedGraph zeroGraph(4, edgeList);
+  SnapshotWriter zeroWriter(4, edgeList);
+  zeroGraph.runKruskalAlgorithm(edges, cost);
+  zeroWriter.getSnapshot()->runKruskalAlgorithm(snapshotEdges, snapshotCost);
+  ASSERT_CONDITION(zeroWriter.getNumEdges() == 2 && !zeroWriter.isAdjacent(0, 1) && !zeroWriter.isAdjacent(3, 2),
+                   "Snapshot zero distance check");
+  ASSERT_CONDITION(edges == snapshotEdges && cost == snapshotCost, "Snapshot zero distance Kruskal check");
+  zeroWriter.setEdgeValue(1, 2, 0.0);
+  zeroWriter.setEdgeValue(1, 3, 0.0);
+  std::shared_ptr<const GraphSnapshot> zeroSnapshot = zeroWriter.publish();
+  ASSERT_CONDITION_SHOW_PASS(zeroSnapshot->getNumEdges() == 1 && !zeroSnapshot->isAdjacent(2, 1) && !zeroSnapshot->isAdjacent(1, 3),
+                             "Snapshot zero distance check");
+}
+
+void UndirectedGraph_TestParallelPrim()
+{
+  std::cerr << "Running Test for Parallel Prim..." << std::endl;
+
+  // a grid with distinct edge values, like a road network, has a single minimum spanning tree
+  const int side = 60;
+  std::vector<WeightedEdge> edgeList;
+  for (int row = 0; row < side; row++) {
+    for (int column = 0; column < side; column++) {
+      int node = row * side + column;
+      if (column + 1 < side) edgeList.push_back(WeightedEdge{ node, node + 1, 1.0 + edgeList.size() * 0.001 });
+      if (row + 1 < side) edgeList.push_back(WeightedEdge{ node, node + side, 1.0 + edgeList.size() * 0.001 });
+    }
+  }
+  std::shuffle(edgeList.begin(), edgeList.end(), std::mt19937(11));
+  UndirectedGraph grid(side * side, edgeList);
+  CompressedGraph compressedGrid(side * side, edgeList);
+
+  std::vector<std::pair<int, int>> edges, parallelEdges;
+  std::vector<double> cost, parallelCost;
+  grid.runPrimAlgorithm(edges, cost);
+  for (std::pair<int, int> &edge : edges) {
+    if (edge.first > edge.second)
+      std::swap(edge.first, edge.second);
+  }
+  std::sort(edges.begin(), edges.end());
+
+  int threadCounts[] = { 1, 2, 4, 8 };
+  for (int numThreads : threadCounts) {
+    grid.runParallelPrimAlgorithm(parallelEdges, parallelCost, numThreads);
+    ASSERT_CONDITION(std::is_sorted(parallelCost.begin(), parallelCost.end()), "Parallel Prim order check");
+    std::sort(parallelEdges.begin(), parallelEdges.end());
+    ASSERT_CONDITION(parallelEdges == edges, "Parallel Prim tree check");
+
+    compressedGrid.runParallelPrimAlgorithm(parallelEdges, parallelCost, numThreads);
+    std::sort(parallelEdges.begin(), parallelEdges.end());
+    ASSERT_CONDITION(parallelEdges == edges, "Parallel Prim compressed tree check");
+  }
+
+  // equal values are broken by node index, so every thread count gives the same forest,
+  // here over two components
+  UndirectedGraph ties(40, 0.0, std::pair<double, double>(1.0, 1.0));
+  for (int i = 0; i < 20; i++) {
+    for (int j = i + 1; j < 20; j++) {
+      ties.setEdgeValue(i, j, 1.0 + (i + j) % 3);
+      ties.setEdgeValue(20 + i, 20 + j, 1.0 + (i * j) % 2);
+    }
+  }
+  std::vector<std::pair<int, int>> firstEdges;
+  ties.runParallelPrimAlgorithm(firstEdges, cost, 1);
+  ties.runKruskalAlgorithm(edges, parallelCost);
+  ASSERT_CONDITION(firstEdges.size() == 38 && std::accumulate(cost.begin(), cost.end(), 0.0) ==
+                   std::accumulate(parallelCost.begin(), parallelCost.end(), 0.0), "Parallel Prim forest check");
+  for (int numThreads : threadCounts) {
+    for (int repeat = 0; repeat < 20; repeat++) {
+      ties.runParallelPrimAlgorithm(parallelEdges, parallelCost, numThreads);
+      ASSERT_CONDITION(parallelEdges == firstEdges, "Parallel Prim tie check");
+    }
+  }
+
+  UndirectedGraph empty(0, 0.0, std::pair<double, double>(1.0, 1.0));
+  empty.runParallelPrimAlgorithm(parallelEdges, parallelCost, 4);
+  ASSERT_CONDITION_SHOW_PASS(parallelEdges.empty(), "Parallel Prim check");
+}
+
+void UndirectedGraph_TestRandomized()
+{
+  std::cerr << "Running Test for Randomized MST..." << std::endl;
+
+  // large enough to recurse several levels before reaching the Kruskal base case
+  const int numNodes = 3000;
+  std::mt19937 generator(5);
+  std::uniform_int_distribution<int> nodes(0, numNodes - 1);
+  std::vector<WeightedEdge> edgeList;
+  for (int i = 0; i < 30000; i++)
+    edgeList.push_back(WeightedEdge{ nodes(generator), nodes(generator), double(i) });
+  std::shuffle(edgeList.begin(), edgeList.end(), generator);
+  // a few nodes of their own component, with repeated values
+  for (int i = 0; i < 20; i++)
+    edgeList.push_back(WeightedEdge{ numNodes + i, numNodes + (i + 1) % 20, double(i % 2) });
+
+  SpanningForest kruskal(numNodes + 20);
+  kruskal.merge(edgeList);
+  std::vector<std::pair<int, int>> edges, randomizedEdges, firstEdges;
+  std::vector<double> cost, randomizedCost;
+  kruskal.getSpanningTree(edges, cost);
+
+  for (uint64_t seed = 1; seed <= 3; seed++) {
+    RandomizedMST randomized(seed);
+    randomized.run(numNodes + 20, edgeList, randomizedEdges, randomizedCost);
+    ASSERT_CONDITION(randomized.getNumRecursiveCalls() > 1 && randomized.getNumBoruvkaSteps() > 0 &&
+                     randomized.getNumDiscardedEdges() > 0, "Randomized recursion check");
+    ASSERT_CONDITION(std::is_sorted(randomizedCost.begin(), randomizedCost.end()), "Randomized order check");
+    ASSERT_CONDITION(std::accumulate(randomizedCost.begin(), randomizedCost.end(), 0.0) ==
+                     std::accumulate(cost.begin(), cost.end(), 0.0) && randomizedEdges.size() == edges.size(),
+                     "Randomized cost check");
+    if (seed == 1) firstEdges = randomizedEdges;
+    ASSERT_CONDITION(randomizedEdges == firstEdges, "Randomized seed independence check");
+  }
+
+  // a long path with chords and many equal values, so the sampled forests have deep trees
+  const int numPathNodes = 20000;
+  std::uniform_int_distribution<int> pathNodes(0, numPathNodes - 1), values(1, 8);
+  std::vector<WeightedEdge> pathList;
+  for (int i = 0; i + 1 < numPathNodes; i++)
+    pathList.push_back(WeightedEdge{ i, i + 1, double(values(generator)) });
+  for (int i = 0; i < 40000; i++)
+    pathList.push_back(WeightedEdge{ pathNodes(generator), pathNodes(generator), double(values(generator)) });
+  std::shuffle(pathList.begin(), pathList.end(), generator);
+
+  SpanningForest pathKruskal(numPathNodes);
+  pathKruskal.merge(pathList);
+  pathKruskal.getSpanningTree(edges, cost);
+  RandomizedMST pathRandomized(7);
+  pathRandomized.run(numPathNodes, pathList, randomizedEdges, randomizedCost);
+  ASSERT_CONDITION(pathRandomized.getNumDiscardedEdges() > 0 &&
+                   std::accumulate(randomizedCost.begin(), randomizedCost.end(), 0.0) ==
+                   std::accumulate(cost.begin(), cost.end(), 0.0) && randomizedEdges.size() == edges.size(),
+                   "Randomized deep forest check");
+
+  // on distinct values the tree is unique, and listed in the same order as by Kruskal's algorithm
+  UndirectedGraph test("SampleTestDataExtra1.txt");
+  CompressedGraph compressed("SampleTestDataExtra1.txt");
+  test.runKruskalAlgorithm(edges, cost);
+  test.runKargerKleinTarjanAlgorithm(randomizedEdges, randomizedCost, RandomizedMST::DefaultSeed);
+  ASSERT_CONDITION(std::accumulate(randomizedCost.begin(), randomizedCost.end(), 0.0) ==
+                   std::accumulate(cost.begin(), cost.end(), 0.0), "Randomized graph check");
+  compressed.runKargerKleinTarjanAlgorithm(randomizedEdges, randomizedCost, 42);
+  ASSERT_CONDITION_SHOW_PASS(randomizedEdges.size() == edges.size(), "Randomized compressed check");
+}
+
 int main()
 {
   UndirectedGraph_TestNodeSanity();
@@ -172,6 +952,17 @@ int main()
   UndirectedGraph_TestAdjacency();
 
   UndirectedGraph_TestReadFromFile();
+  UndirectedGraph_TestReordering();
+  UndirectedGraph_TestCompressedBackend();
+  UndirectedGraph_TestDistributed();
+  UndirectedGraph_TestPipelined();
+  UndirectedGraph_TestSmallGraph();
+  UndirectedGraph_TestQueueTypes();
+  UndirectedGraph_TestPackedStorage();
+  UndirectedGraph_TestResultCache();
+  UndirectedGraph_TestSnapshots();
+  UndirectedGraph_TestParallelPrim();
+  UndirectedGraph_TestRandomized();
 
   return 0;
 }
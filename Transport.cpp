@@ -0,0 +1,90 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// Transport.cpp
+
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "Transport.hpp"
+
+UnixSocketTransport::UnixSocketTransport(int numProcesses)
+{
+  this->numProcesses = numProcesses;
+  this->rank = -1;
+
+  sockets.assign(numProcesses * numProcesses, -1);
+  for (int i = 0; i < numProcesses; ++i) {
+    for (int j = i + 1; j < numProcesses; ++j) {
+      int pair[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) == 0) {
+        socketOf(i, j) = pair[0];
+        socketOf(j, i) = pair[1];
+      }
+    }
+  }
+}
+
+UnixSocketTransport::~UnixSocketTransport()
+{
+  close();
+}
+
+bool UnixSocketTransport::open(int rank)
+{
+  this->rank = rank;
+
+  // close the ends that belong to the other processes, so that a process that exits
+  // early is seen as the end of the stream instead of blocking its peers forever
+  for (int i = 0; i < numProcesses; ++i) {
+    for (int j = 0; j < numProcesses; ++j) {
+      if (i != rank && socketOf(i, j) >= 0) {
+        ::close(socketOf(i, j));
+        socketOf(i, j) = -1;
+      }
+    }
+  }
+
+  for (int j = 0; j < numProcesses; ++j) {
+    if (j != rank && socketOf(rank, j) < 0)
+      return false; // the socket pair could not be created
+  }
+  return true;
+}
+
+bool UnixSocketTransport::send(int destination, const void *data, size_t size)
+{
+  int socket = socketOf(rank, destination);
+  const char *position = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t written = ::send(socket, position, size, MSG_NOSIGNAL);
+    if (written < 0 && errno == EINTR) continue;
+    if (written <= 0) return false;
+    position += written;
+    size -= written;
+  }
+  return true;
+}
+
+bool UnixSocketTransport::receive(int source, void *data, size_t size)
+{
+  int socket = socketOf(rank, source);
+  char *position = static_cast<char*>(data);
+  while (size > 0) {
+    ssize_t received = ::recv(socket, position, size, 0);
+    if (received < 0 && errno == EINTR) continue;
+    if (received <= 0) return false;
+    position += received;
+    size -= received;
+  }
+  return true;
+}
+
+void UnixSocketTransport::close()
+{
+  for (auto it = sockets.begin(); it != sockets.end(); ++it) {
+    if (*it >= 0) {
+      ::close(*it);
+      *it = -1;
+    }
+  }
+}
@@ -0,0 +1,94 @@
+// Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
+// Transport.hpp
+
+#ifndef _HW3_TRANSPORT_H_
+#define _HW3_TRANSPORT_H_
+
+#include <vector>
+#include <cstddef>
+
+using namespace std;
+
+// Carries messages between the processes of a distributed computation. Each process is
+// identified by its rank, from 0 to the number of processes - 1. The transport is created
+// before the processes are started, and each process opens it once with its own rank. A
+// transport carries a single computation: once closed, it cannot be opened again.
+class Transport
+{
+public:
+  // Destructor.
+  virtual ~Transport() {}
+
+  // Gets the number of processes this transport connects.
+  // @return The number of processes.
+  virtual int getNumProcesses() = 0;
+
+  // Prepares the transport for use by the calling process.
+  // @param rank The rank of the calling process.
+  // @return True on success, false otherwise.
+  virtual bool open(int rank) = 0;
+
+  // Sends a message to another process; blocks until the message has been handed off.
+  // @param destination The rank of the receiving process.
+  // @param data The message.
+  // @param size The size of the message, in bytes.
+  // @return True on success, false otherwise.
+  virtual bool send(int destination, const void *data, size_t size) = 0;
+
+  // Receives a message from another process; blocks until all of it has arrived.
+  // @param source The rank of the sending process.
+  // @param data The buffer to fill.
+  // @param size The size of the message, in bytes.
+  // @return True on success, false otherwise (including when the sender has exited).
+  virtual bool receive(int source, void *data, size_t size) = 0;
+
+  // Releases the calling process's end of the transport.
+  virtual void close() = 0;
+};
+
+// A transport made of one Unix domain socket pair per pair of processes; the processes
+// must be forked from the one that created the transport.
+class UnixSocketTransport : public Transport
+{
+public:
+  // Constructor; creates the sockets for all the processes.
+  // @param numProcesses The number of processes.
+  UnixSocketTransport(int numProcesses);
+
+  // Destructor.
+  ~UnixSocketTransport();
+
+  int getNumProcesses();
+  bool open(int rank);
+  bool send(int destination, const void *data, size_t size);
+  bool receive(int source, void *data, size_t size);
+  void close();
+
+private:
+  // Gets the socket the given process uses to talk to the other process.
+  int& socketOf(int rank, int peer);
+
+  // The number of processes.
+  int numProcesses;
+
+  // The rank of the process using this transport, or -1 if it has not been opened.
+  int rank;
+
+  // The socket descriptors; socketOf(i, j) is process i's end of the pair shared with process j.
+  vector<int> sockets;
+
+};
+
+// Inline function definitions placed here to avoid linker errors.
+
+inline int UnixSocketTransport::getNumProcesses()
+{
+  return numProcesses;
+}
+
+inline int& UnixSocketTransport::socketOf(int rank, int peer)
+{
+  return sockets[rank * numProcesses + peer];
+}
+
+#endif // _HW3_TRANSPORT_H_
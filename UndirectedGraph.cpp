@@ -1,16 +1,19 @@
 // Homework 3: Compute the Minimum Spanning Tree for an Inputted Graph
 // UndirectedGraph.cpp
 
+#include <algorithm>
+
 #include "UndirectedGraph.hpp"
+#include "RandomizedMST.hpp"
 
 UndirectedGraph::UndirectedGraph(int numNodes, double density, pair<double, double> distRange)
 {
   this->numNodes = numNodes;
   this->numEdges = 0;
+  this->version = 0;
+  primCache.valid = kruskalCache.valid = false;
 
   adjacencyMatrix.resize(numNodes);
-  for (auto it = adjacencyMatrix.begin(); it != adjacencyMatrix.end(); ++it)
-    it->resize(numNodes, 0.0);
 
   nodeValues.resize(numNodes, numeric_limits<double>::max());
 
@@ -36,10 +39,10 @@ UndirectedGraph::UndirectedGraph(const char* filename)
 
   infile >> numNodes;
   numEdges = 0;
+  version = 0;
+  primCache.valid = kruskalCache.valid = false;
 
   adjacencyMatrix.resize(numNodes);
-  for (auto it = adjacencyMatrix.begin(); it != adjacencyMatrix.end(); ++it)
-    it->resize(numNodes, 0.0);
 
   nodeValues.resize(numNodes, numeric_limits<double>::max());
 
@@ -50,86 +53,118 @@ UndirectedGraph::UndirectedGraph(const char* filename)
     addEdge(node1, node2, cost);
 }
 
-void UndirectedGraph::getNeighbors(int node, vector<int> &neighbors)
+UndirectedGraph::UndirectedGraph(int numNodes, const vector<WeightedEdge> &edgeList)
 {
-  neighbors.clear();
-  for (auto it = adjacencyMatrix[node].begin(); it != adjacencyMatrix[node].end(); ++it) {
-    if (*it != 0.0)
-      neighbors.push_back(it - adjacencyMatrix[node].begin());
-  }
+  this->numNodes = numNodes;
+  this->numEdges = 0;
+  this->version = 0;
+  primCache.valid = kruskalCache.valid = false;
+
+  adjacencyMatrix.resize(numNodes);
+
+  nodeValues.resize(numNodes, numeric_limits<double>::max());
+
+  for (auto it = edgeList.begin(); it != edgeList.end(); ++it)
+    addEdge(it->node1, it->node2, it->value);
 }
 
-void UndirectedGraph::runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost)
+void UndirectedGraph::readEdgeList(const char* filename, int &numNodes, vector<WeightedEdge> &edgeList)
 {
-  if (numNodes == 0) return; // account for empty graph
+  ifstream infile(filename);
 
-  edges.clear();
-  cost.clear();
+  edgeList.clear();
+  numNodes = 0;
+  infile >> numNodes;
 
-  PriorityQueue<pair<int, int>, double> pq(false);
-  unordered_set<int> visitedNodes;
-  vector<int> neighbors;
-  double edgeValue;
-  pair<int, int> edge; // as a pair of nodes
+  // read the two integer nodes and the cost as a double; process each set
+  WeightedEdge edge;
+  while (infile >> edge.node1 >> edge.node2 >> edge.value)
+    edgeList.push_back(edge);
+}
 
-  visitedNodes.insert(0); // initialize the starting node
-  getNeighbors(0, neighbors);
-  for (auto it = neighbors.begin(); it != neighbors.end(); ++it) // initialize candidate edges
-    pq.push(pair<int, int>(0, *it), getEdgeValue(0, *it));
+void UndirectedGraph::resolveEdgeList(vector<WeightedEdge> &edgeList)
+{
+  // group the lines of each node pair, keeping them in the order they were read
+  vector<size_t> order(edgeList.size());
+  for (size_t i = 0; i < order.size(); ++i)
+    order[i] = i;
+  auto pairOf = [&edgeList](size_t i) { return minmax(edgeList[i].node1, edgeList[i].node2); };
+  stable_sort(order.begin(), order.end(), [&pairOf](size_t lhs, size_t rhs) { return pairOf(lhs) < pairOf(rhs); });
+
+  // only the last line of each pair counts, and only if it is an edge
+  vector<bool> keep(edgeList.size(), false);
+  for (size_t i = 0; i < order.size(); ++i) {
+    if (i + 1 < order.size() && pairOf(order[i + 1]) == pairOf(order[i])) continue; // replaced by a later line
+    keep[order[i]] = (edgeList[order[i]].value != 0.0);
+  }
 
-  // repeat until we have visited all the nodes
-  while (visitedNodes.size() != numNodes) {
-    edgeValue = pq.getTopPriority();
-    edge = pq.pop();
+  size_t numKept = 0;
+  for (size_t i = 0; i < edgeList.size(); ++i) {
+    if (keep[i])
+      edgeList[numKept++] = edgeList[i];
+  }
+  edgeList.resize(numKept);
+}
 
-    // start again if we have already visited the destination node
-    if (visitedNodes.count(edge.second) > 0) continue;
+void UndirectedGraph::getNeighbors(int node, vector<int> &neighbors)
+{
+  neighbors.clear();
+  forEachNeighbor(node, [&neighbors](int neighbor, double) { neighbors.push_back(neighbor); });
+}
 
-    visitedNodes.insert(edge.second); // mark the destination node as visited
+void UndirectedGraph::runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/)
+{
+  if (numNodes == 0) return; // account for empty graph
+  if (readCache(primCache, queueType, edges, cost)) return;
 
-    // record the edge and its cost
-    cost.push_back(edgeValue);
-    edges.push_back(edge);
+  MinimumSpanningTree<UndirectedGraph>::runPrimAlgorithm(*this, edges, cost, queueType);
+  writeCache(primCache, queueType, edges, cost);
+}
 
-    // add condidate edges, ignoring visited nodes
-    getNeighbors(edge.second, neighbors);
-    for (auto it = neighbors.begin(); it != neighbors.end(); ++it) {
-      if (visitedNodes.count(*it) == 0)
-        pq.push(pair<int, int>(edge.second, *it), getEdgeValue(edge.second, *it));
-    }
-  }
+void UndirectedGraph::runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads)
+{
+  MinimumSpanningTree<UndirectedGraph>::runParallelPrimAlgorithm(*this, edges, cost, numThreads);
 }
 
-void UndirectedGraph::runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost)
+void UndirectedGraph::runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType /*=QueueType::BinaryHeap*/)
 {
   if (numNodes == 0) return; // account for empty graph
+  if (readCache(kruskalCache, queueType, edges, cost)) return;
 
-  edges.clear();
-  cost.clear();
-
-  DisjointSet ds(numNodes);
-  PriorityQueue<pair<int, int>, double> pq(false);
-  double edgeValue;
-  pair<int, int> edge; // as a pair of nodes
+  MinimumSpanningTree<UndirectedGraph>::runKruskalAlgorithm(*this, edges, cost, queueType);
+  writeCache(kruskalCache, queueType, edges, cost);
+}
 
-  for (int i = 0; i < numNodes - 1; ++i) {
-    for (int j = i + 1; j < numNodes; ++j) {
-      if (isAdjacent(i, j))
-        pq.push(pair<int, int>(i, j), getEdgeValue(i, j));
-    }
+void UndirectedGraph::runKargerKleinTarjanAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, uint64_t seed)
+{
+  // collect each edge once, from its lower numbered node
+  vector<WeightedEdge> edgeList;
+  edgeList.reserve(numEdges);
+  for (int i = 0; i < numNodes; ++i) {
+    forEachHigherNeighbor(i, [&edgeList, i](int neighbor, double value) {
+      edgeList.push_back(WeightedEdge{ i, neighbor, value });
+    });
   }
 
-  while (!pq.empty()) {
-    edgeValue = pq.getTopPriority();
-    edge = pq.pop();
+  RandomizedMST randomized(seed);
+  randomized.run(numNodes, edgeList, edges, cost);
+}
 
-    if (!ds.isConnected(edge.first, edge.second)) {
-      // record the edge and its cost
-      cost.push_back(edgeValue);
-      edges.push_back(edge);
+bool UndirectedGraph::readCache(CachedSpanningTree &cache, QueueType queueType, vector<pair<int, int>> &edges, vector<double> &cost)
+{
+  if (!cache.valid || cache.version != version || cache.queueType != queueType)
+    return false;
 
-      ds.merge(edge.first, edge.second); // connect the two sets
-    }
-  }
+  edges = cache.edges;
+  cost = cache.cost;
+  return true;
 }
 
+void UndirectedGraph::writeCache(CachedSpanningTree &cache, QueueType queueType, const vector<pair<int, int>> &edges, const vector<double> &cost)
+{
+  cache.valid = true;
+  cache.version = version;
+  cache.queueType = queueType;
+  cache.edges = edges;
+  cache.cost = cost;
+}
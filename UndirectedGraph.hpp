@@ -12,12 +12,23 @@
 #include <limits>
 #include <chrono>
 #include <random>
+#include <cstdint>
 
 #include "PriorityQueue.hpp"
 #include "DisjointSet.hpp"
+#include "MinimumSpanningTree.hpp"
+#include "PackedSymmetricMatrix.hpp"
 
 using namespace std;
 
+// An edge between two nodes and its distance, as read from an edge list file.
+struct WeightedEdge
+{
+  int node1; // the first node
+  int node2; // the second node
+  double value; // the edge distance
+};
+
 class UndirectedGraph
 {
 public:
@@ -31,6 +42,24 @@ public:
   // @param filename The string representing the name of the file to open.
   UndirectedGraph(const char* filename);
 
+  // Constructor.
+  // @param numNodes The number of nodes in this graph.
+  // @param edgeList The edges to add to this graph.
+  UndirectedGraph(int numNodes, const vector<WeightedEdge> &edgeList);
+
+  // Reads an edge list file without building a graph from it; the first value is the
+  // number of nodes, followed by one "node1 node2 cost" triple per edge.
+  // @param filename The string representing the name of the file to open.
+  // @param numNodes The number of nodes returned.
+  // @param edgeList The reference vector of edges returned; any existing content will be cleared.
+  static void readEdgeList(const char* filename, int &numNodes, vector<WeightedEdge> &edgeList);
+
+  // Applies the rules used when a graph is built from an edge list to the list itself: a
+  // repeated edge, in either direction, keeps its last distance, and a distance of 0.0 is
+  // no edge. The edges that remain keep their order.
+  // @param edgeList The reference vector of edges to resolve in place.
+  static void resolveEdgeList(vector<WeightedEdge> &edgeList);
+
   // Returns the number of nodes in this graph.
   // @return The number of nodes in this graph.
   int getNumNodes();
@@ -39,6 +68,15 @@ public:
   // @return The number of edges in this graph.
   int getNumEdges();
 
+  // Returns the mutation version of this graph, which changes whenever an edge is added,
+  // deleted or changed.
+  // @return The version number.
+  unsigned long getVersion();
+
+  // Returns the number of bytes used by the adjacency matrix and the node values.
+  // @return The memory used, in bytes.
+  size_t getMemoryUsage();
+
   // Test if there is an edge between two nodes.
   // @param node1 The first node.
   // @param node2 The second node.
@@ -50,6 +88,19 @@ public:
   // @param neighbors The reference vector of neighbors returned; any existing content will be cleared.
   void getNeighbors(int node, vector<int> &neighbors);
 
+  // Calls the visitor for every node connected to the given node, without building a neighbor list.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachNeighbor(int node, Visitor visit);
+
+  // Calls the visitor for every node with a higher index connected to the given node; over
+  // all nodes, this visits each edge once.
+  // @param node The node to check for any connections.
+  // @param visit The function called as visit(neighbor, edgeValue) for each connection.
+  template <typename Visitor>
+  void forEachHigherNeighbor(int node, Visitor visit);
+
   // Adds an edge between the two nodes.
   // @param node1 The first node.
   // @param node2 The second node.
@@ -83,17 +134,52 @@ public:
   // @param dist The edge value to set.
   void setEdgeValue(int node1, int node2, double value);
 
-  // Run Prim's Algorithm to find the Minimum Spanning Tree of this graph.
+  // Run Prim's Algorithm to find the Minimum Spanning Tree of this graph. The result is
+  // cached, and returned without recomputing it until the graph changes.
   // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
   // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
-  void runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost);
+  // @param queueType The priority queue to use for the candidate edges.
+  void runPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap);
+
+  // Run Prim's Algorithm from several seed nodes at once, in parallel, joining the trees that
+  // meet with Kruskal's algorithm; ties between equal edge values are broken by node index.
+  // @param edges The reference vector of edges (as pairs of node indices, lower node first), in increasing order of cost; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param numThreads The number of threads to use.
+  void runParallelPrimAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, int numThreads);
 
-  // Run Kruskal's Algorithm to find the Minimum Spanning Tree of this graph.
+  // Run Kruskal's Algorithm to find the Minimum Spanning Tree of this graph. The result is
+  // cached, and returned without recomputing it until the graph changes.
   // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
   // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
-  void runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost);
+  // @param queueType The priority queue to use for the candidate edges.
+  void runKruskalAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, QueueType queueType = QueueType::BinaryHeap);
+
+  // Run the randomized algorithm of Karger, Klein and Tarjan to find the Minimum Spanning
+  // Tree of this graph, in expected linear time; see RandomizedMST.
+  // @param edges The reference vector of edges (as pairs of node indices) returned; any existing content will be cleared.
+  // @param cost The reference vector of costs (associated with the edges) returned; any existing content will be cleared.
+  // @param seed The seed of the random sampling; the result does not depend on it, only the running time.
+  void runKargerKleinTarjanAlgorithm(vector<pair<int, int>> &edges, vector<double> &cost, uint64_t seed);
 
 private:
+  // A spanning tree computed earlier, and what it was computed from.
+  struct CachedSpanningTree
+  {
+    bool valid; // true once a tree has been stored
+    unsigned long version; // the graph version the tree was computed for
+    QueueType queueType; // the priority queue used to compute the tree
+    vector<pair<int, int>> edges; // the edges of the tree
+    vector<double> cost; // the costs of the edges
+  };
+
+  // Copies the cached tree to the result if it is up to date.
+  // @return True if the cached tree was used, false otherwise.
+  bool readCache(CachedSpanningTree &cache, QueueType queueType, vector<pair<int, int>> &edges, vector<double> &cost);
+
+  // Stores a computed tree in the cache.
+  void writeCache(CachedSpanningTree &cache, QueueType queueType, const vector<pair<int, int>> &edges, const vector<double> &cost);
+
   // The number of nodes in this undirected graph.
   int numNodes;
 
@@ -102,12 +188,20 @@ private:
 
   // The graph, represented by an adjacency matrix.
   // Each value in the matrix represents the distance between
-  // the nodes (which are represented by the vector indices).
-  vector<vector<double>> adjacencyMatrix;
+  // the nodes (which are represented by the matrix indices);
+  // only the upper triangle is stored, as the matrix is symmetric.
+  PackedSymmetricMatrix adjacencyMatrix;
 
   // The value of each node in this undirected graph.
   vector<double> nodeValues;
 
+  // Incremented by every change to the edges.
+  unsigned long version;
+
+  // The last spanning trees computed by each algorithm.
+  CachedSpanningTree primCache;
+  CachedSpanningTree kruskalCache;
+
 };
 
 // Inline function definitions placed here to avoid linker errors.
@@ -122,9 +216,31 @@ inline int UndirectedGraph::getNumEdges()
   return numEdges;
 }
 
+inline unsigned long UndirectedGraph::getVersion()
+{
+  return version;
+}
+
+inline size_t UndirectedGraph::getMemoryUsage()
+{
+  return adjacencyMatrix.getMemoryUsage() + nodeValues.size() * sizeof(double);
+}
+
 inline bool UndirectedGraph::isAdjacent(int node1, int node2)
 {
-  return adjacencyMatrix[node1][node2] != 0.0;
+  return adjacencyMatrix.get(node1, node2) != 0.0;
+}
+
+template <typename Visitor>
+inline void UndirectedGraph::forEachNeighbor(int node, Visitor visit)
+{
+  adjacencyMatrix.forEachNonzeroInRow(node, visit);
+}
+
+template <typename Visitor>
+inline void UndirectedGraph::forEachHigherNeighbor(int node, Visitor visit)
+{
+  adjacencyMatrix.forEachNonzeroAboveDiagonal(node, visit);
 }
 
 inline void UndirectedGraph::addEdge(int node1, int node2, double dist)
@@ -134,10 +250,10 @@ inline void UndirectedGraph::addEdge(int node1, int node2, double dist)
 
 inline void UndirectedGraph::deleteEdge(int node1, int node2)
 {
-  adjacencyMatrix[node1][node2] = 0.0;
-  adjacencyMatrix[node2][node1] = 0.0;
+  adjacencyMatrix.set(node1, node2, 0.0);
 
   numEdges--; // update the number of edges
+  version++;
 }
 
 inline double UndirectedGraph::getNodeValue(int node)
@@ -152,7 +268,7 @@ inline void UndirectedGraph::setNodeValue(int node, double value)
 
 inline double UndirectedGraph::getEdgeValue(int node1, int node2)
 {
-  return adjacencyMatrix[node1][node2];
+  return adjacencyMatrix.get(node1, node2);
 }
 
 inline void UndirectedGraph::setEdgeValue(int node1, int node2, double value)
@@ -161,8 +277,8 @@ inline void UndirectedGraph::setEdgeValue(int node1, int node2, double value)
   if (!isAdjacent(node1, node2))
     numEdges++;
 
-  adjacencyMatrix[node1][node2] = value;
-  adjacencyMatrix[node2][node1] = value;
+  adjacencyMatrix.set(node1, node2, value);
+  version++;
 }
 
 #endif // _HW3_UNDIRECTED_GRAPH_H_